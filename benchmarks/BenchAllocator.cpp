@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   BenchAllocator.cpp
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 14:05
+ */
+
+/// Internal libs includes
+#include "Benchmark.h"
+#include "dynobjects/Standard.h"
+#include "dynobjects/BasicTypes.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <string>
+
+using namespace DynObjects;
+
+namespace
+{
+    /// Benchmark configuration
+
+    const size_t Requests = 10000;
+    const size_t Fields = 16;
+    const size_t Runs = 5;
+
+    /**
+     * Builds and drops a short-lived request context
+     */
+    void HandleRequest()
+    {
+        Dictionary pContext;
+
+        for(size_t i = 0; i < Fields; ++i)
+        {
+            (*pContext)[Integer(static_cast<int>(i))] =
+                String("VALUE_" + std::to_string(i));
+        }
+
+        DoNotOptimize((*pContext).size());
+    }
+}
+
+int main()
+{
+#ifdef DYNOBJECTS_POOL_ALLOCATOR
+    std::printf("Allocator: thread-local pools\n");
+#else
+    std::printf("Allocator: global\n");
+#endif
+
+    Measure("Build request contexts", Requests * Fields, Runs, []()
+    {
+        for(size_t i = 0; i < Requests; ++i)
+        {
+            HandleRequest();
+        }
+    });
+
+    Measure("Build request contexts (arena)", Requests * Fields, Runs, []()
+    {
+        for(size_t i = 0; i < Requests; ++i)
+        {
+            ArenaScope arena;
+            HandleRequest();
+        }
+    });
+
+    return 0;
+}
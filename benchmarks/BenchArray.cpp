@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   BenchArray.cpp
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 20:10
+ */
+
+/// Internal libs includes
+#include "Benchmark.h"
+#include "dynobjects/Standard.h"
+#include "dynobjects/BasicTypes.h"
+#include "dynobjects/ObjectArray.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <vector>
+
+using namespace DynObjects;
+
+namespace
+{
+    /// Benchmark configuration
+
+    const size_t Items = 1000000;
+    const size_t Runs = 5;
+}
+
+int main()
+{
+    Vector<ObjectPtr> pBoxed;
+    DoubleArray pArray;
+
+    for(size_t i = 0; i < Items; ++i)
+    {
+        (*pBoxed).push_back(Double(i * 0.5));
+        (*pArray).push_back(i * 0.5);
+    }
+
+    Measure("Sum boxed doubles", Items, Runs, [&]()
+    {
+        double sum = 0;
+        for(const ObjectPtr &item : *pBoxed)
+        {
+            sum += *Double(item);
+        }
+        DoNotOptimize(sum);
+    });
+
+    Measure("Sum array span", Items, Runs, [&]()
+    {
+        double sum = 0;
+        for(double item : pArray.GetObject().GetSpan())
+        {
+            sum += item;
+        }
+        DoNotOptimize(sum);
+    });
+
+    Measure("Sum array boxed view", Items, Runs, [&]()
+    {
+        double sum = 0;
+        for(ObjectPtr item : pArray.GetObject().GetBoxed())
+        {
+            sum += *Double(item);
+        }
+        DoNotOptimize(sum);
+    });
+
+    Measure("Hash boxed doubles", Items, Runs, [&]()
+    {
+        DoNotOptimize(std::hash<ObjectPtr>()(pBoxed));
+    });
+
+    Measure("Hash array", Items, Runs, [&]()
+    {
+        DoNotOptimize(std::hash<ObjectPtr>()(pArray));
+    });
+
+    return 0;
+}
@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   BenchAtom.cpp
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 21:30
+ */
+
+/// Internal libs includes
+#include "Benchmark.h"
+#include "dynobjects/Atom.h"
+#include "dynobjects/Standard.h"
+#include "dynobjects/BasicTypes.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace DynObjects;
+
+namespace
+{
+    /// Benchmark configuration
+
+    const size_t Keys = 1000;
+    const size_t Lookups = 1000000;
+    const size_t Runs = 5;
+
+    /**
+     * Key names, longer than the small string buffer
+     * @return Key names
+     */
+    std::vector<std::string> BuildNames()
+    {
+        std::vector<std::string> names;
+
+        for(size_t i = 0; i < Keys; ++i)
+        {
+            names.push_back("CONFIGURATION_KEY_" + std::to_string(i));
+        }
+
+        return names;
+    }
+
+    /**
+     * Interns names from several threads at once
+     * @param names Names to intern
+     * @param threads Number of threads
+     */
+    void InternConcurrently(const std::vector<std::string> &names,
+                            size_t threads)
+    {
+        std::vector<std::thread> workers;
+
+        for(size_t t = 0; t < threads; ++t)
+        {
+            workers.emplace_back([&names, threads]()
+            {
+                for(size_t i = 0; i < Lookups / threads; ++i)
+                {
+                    DoNotOptimize(Symbol(names[i % names.size()]));
+                }
+            });
+        }
+
+        for(std::thread &worker : workers)
+        {
+            worker.join();
+        }
+    }
+}
+
+int main()
+{
+    const std::vector<std::string> names = BuildNames();
+
+    std::vector<ObjectPtr> strings;
+    std::vector<ObjectPtr> atoms;
+    Dictionary pStrings;
+    Dictionary pAtoms;
+
+    for(const std::string &name : names)
+    {
+        strings.push_back(String(name));
+        atoms.push_back(Atom(name));
+        (*pStrings)[strings.back()] = Integer(1);
+        (*pAtoms)[atoms.back()] = Integer(1);
+    }
+
+    Measure("Dictionary lookup, String keys", Lookups, Runs, [&]()
+    {
+        for(size_t i = 0; i < Lookups; ++i)
+        {
+            DoNotOptimize((*pStrings).find(strings[i % Keys]));
+        }
+    });
+
+    Measure("Dictionary lookup, Atom keys", Lookups, Runs, [&]()
+    {
+        for(size_t i = 0; i < Lookups; ++i)
+        {
+            DoNotOptimize((*pAtoms).find(atoms[i % Keys]));
+        }
+    });
+
+    std::vector<Symbol> symbols(names.begin(), names.end());
+    Map<std::string, ObjectPtr> pStringMap;
+    Map<Symbol, ObjectPtr> pSymbolMap;
+
+    for(size_t i = 0; i < Keys; ++i)
+    {
+        (*pStringMap)[names[i]] = Integer(1);
+        (*pSymbolMap)[symbols[i]] = Integer(1);
+    }
+
+    Measure("Ordered map lookup, string keys", Lookups, Runs, [&]()
+    {
+        for(size_t i = 0; i < Lookups; ++i)
+        {
+            DoNotOptimize((*pStringMap).find(names[i % Keys]));
+        }
+    });
+
+    Measure("Ordered map lookup, symbol keys", Lookups, Runs, [&]()
+    {
+        for(size_t i = 0; i < Lookups; ++i)
+        {
+            DoNotOptimize((*pSymbolMap).find(symbols[i % Keys]));
+        }
+    });
+
+    for(size_t threads : {1, 2, 4, 8})
+    {
+        std::string name = "Intern existing names, " +
+            std::to_string(threads) + " threads";
+
+        Measure(name.c_str(), Lookups, Runs, [&]()
+        {
+            InternConcurrently(names, threads);
+        });
+    }
+
+    return 0;
+}
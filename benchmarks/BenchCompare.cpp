@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   BenchCompare.cpp
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 15:10
+ */
+
+/// Internal libs includes
+#include "Benchmark.h"
+#include "dynobjects/Standard.h"
+#include "dynobjects/BasicTypes.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace DynObjects;
+
+namespace
+{
+    /// Benchmark configuration
+
+    const size_t Objects = 100000;
+    const size_t Runs = 5;
+
+    /**
+     * Builds a shuffled list of string objects
+     * @return List of objects
+     */
+    std::vector<ObjectPtr> BuildObjects()
+    {
+        std::vector<ObjectPtr> objects;
+
+        for(size_t i = 0; i < Objects; ++i)
+        {
+            objects.push_back(String("KEY_" +
+                std::to_string((i * 7919) % Objects)));
+        }
+
+        return objects;
+    }
+
+    /**
+     * Builds a shuffled list of integer instances
+     * @return List of instances
+     */
+    std::vector<Integer> BuildIntegers()
+    {
+        std::vector<Integer> integers;
+
+        for(size_t i = 0; i < Objects; ++i)
+        {
+            integers.push_back(Integer(static_cast<int>((i * 7919) % Objects)));
+        }
+
+        return integers;
+    }
+}
+
+int main()
+{
+    const std::vector<ObjectPtr> objects = BuildObjects();
+
+    std::map<ObjectPtr, size_t> index;
+    for(size_t i = 0; i < objects.size(); ++i)
+    {
+        index[objects[i]] = i;
+    }
+
+    std::map<ObjectPtr, size_t, DictionaryComparator> mixed;
+    for(size_t i = 0; i < objects.size(); ++i)
+    {
+        mixed[objects[i]] = i;
+        mixed[Integer(static_cast<int>(i))] = i;
+    }
+
+    Measure("Sort string objects", Objects, Runs, [&]()
+    {
+        std::vector<ObjectPtr> sorted(objects);
+        std::sort(sorted.begin(), sorted.end());
+        DoNotOptimize(sorted.data());
+    });
+
+    Measure("Ordered map lookup", Objects, Runs, [&]()
+    {
+        for(const ObjectPtr &key : objects)
+        {
+            DoNotOptimize(index.find(key)->second);
+        }
+    });
+
+    Measure("Mixed-type ordered map lookup", 2 * Objects, Runs, [&]()
+    {
+        for(size_t i = 0; i < objects.size(); ++i)
+        {
+            DoNotOptimize(mixed.find(objects[i])->second);
+            DoNotOptimize(mixed.find(Integer(static_cast<int>(i)))->second);
+        }
+    });
+
+    const std::vector<Integer> integers = BuildIntegers();
+    const std::vector<ObjectPtr> pointers(integers.begin(), integers.end());
+
+    Measure("Sort integer pointers", Objects, Runs, [&]()
+    {
+        std::vector<ObjectPtr> sorted(pointers);
+        std::sort(sorted.begin(), sorted.end());
+        DoNotOptimize(sorted.data());
+    });
+
+    Measure("Sort integer instances", Objects, Runs, [&]()
+    {
+        std::vector<Integer> sorted(integers);
+        std::sort(sorted.begin(), sorted.end());
+        DoNotOptimize(sorted.data());
+    });
+
+    Measure("Hash integer pointers", Objects, Runs, [&]()
+    {
+        std::hash<ObjectPtr> hasher;
+        size_t hash = 0;
+        for(const ObjectPtr &item : pointers)
+        {
+            hash ^= hasher(item);
+        }
+        DoNotOptimize(hash);
+    });
+
+    Measure("Hash integer instances", Objects, Runs, [&]()
+    {
+        std::hash<Integer> hasher;
+        size_t hash = 0;
+        for(const Integer &item : integers)
+        {
+            hash ^= hasher(item);
+        }
+        DoNotOptimize(hash);
+    });
+
+    return 0;
+}
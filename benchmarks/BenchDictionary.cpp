@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   BenchDictionary.cpp
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 16:50
+ */
+
+/// Internal libs includes
+#include "Benchmark.h"
+#include "dynobjects/Standard.h"
+#include "dynobjects/BasicTypes.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <string>
+#include <vector>
+
+using namespace DynObjects;
+
+namespace
+{
+    /// Benchmark configuration
+
+    const size_t Keys = 10000;
+    const size_t Rounds = 100;
+    const size_t Runs = 5;
+    const size_t LongKeySize = 256;
+
+    /**
+     * Builds the lookup keys, half strings and half integers
+     * @return List of keys
+     */
+    std::vector<ObjectPtr> BuildKeys()
+    {
+        std::vector<ObjectPtr> keys;
+
+        for(size_t i = 0; i < Keys; ++i)
+        {
+            if(i % 2)
+            {
+                keys.push_back(String("config.key." + std::to_string(i)));
+            }
+            else
+            {
+                keys.push_back(Integer(static_cast<int>(i)));
+            }
+        }
+
+        return keys;
+    }
+
+    /**
+     * Looks up every key many times
+     * @param pContext Dictionary to look into
+     * @param keys Keys to look for
+     */
+    template<typename _Dictionary>
+    void Lookup(const _Dictionary &pContext, const std::vector<ObjectPtr> &keys)
+    {
+        for(size_t i = 0; i < Rounds; ++i)
+        {
+            for(const ObjectPtr &key : keys)
+            {
+                DoNotOptimize(&(*pContext).find(key)->second);
+            }
+        }
+    }
+
+    /**
+     * Looks up every string key many times, boxing it on every lookup
+     * @param pContext Dictionary to look into
+     * @param names Raw string keys to look for
+     */
+    void BoxedLookup(const Dictionary &pContext,
+                     const std::vector<std::string> &names)
+    {
+        for(size_t i = 0; i < Rounds; ++i)
+        {
+            for(const std::string &name : names)
+            {
+                DoNotOptimize(&(*pContext).find(String(name))->second);
+            }
+        }
+    }
+
+    /**
+     * Looks up every string key many times, without boxing it
+     * @param pContext Dictionary to look into
+     * @param names Raw string keys to look for
+     */
+    void RawLookup(const Dictionary &pContext,
+                   const std::vector<std::string> &names)
+    {
+        for(size_t i = 0; i < Rounds; ++i)
+        {
+            for(const std::string &name : names)
+            {
+                DoNotOptimize(&(*pContext).find(name)->second);
+            }
+        }
+    }
+}
+
+int main()
+{
+    const std::vector<ObjectPtr> keys = BuildKeys();
+
+    Dictionary pFlat;
+    NodeDictionary pNode;
+
+    for(const ObjectPtr &key : keys)
+    {
+        (*pFlat)[key] = key;
+        (*pNode)[key] = key;
+    }
+
+    Measure("Dictionary lookup (flat)", Rounds * Keys, Runs,
+            [&]() { Lookup(pFlat, keys); });
+    Measure("Dictionary lookup (node)", Rounds * Keys, Runs,
+            [&]() { Lookup(pNode, keys); });
+
+    std::vector<std::string> names;
+    for(size_t i = 1; i < Keys; i += 2)
+    {
+        names.push_back("config.key." + std::to_string(i));
+    }
+
+    Measure("Dictionary string lookup (boxed key)", Rounds * names.size(),
+            Runs, [&]() { BoxedLookup(pFlat, names); });
+    Measure("Dictionary string lookup (raw key)", Rounds * names.size(),
+            Runs, [&]() { RawLookup(pFlat, names); });
+
+    std::vector<ObjectPtr> mutableKeys;
+    std::vector<ObjectPtr> frozenKeys;
+    Dictionary pLong;
+
+    for(size_t i = 0; i < Keys; ++i)
+    {
+        std::string name(LongKeySize, 'K');
+        name += std::to_string(i);
+
+        mutableKeys.push_back(String(name));
+        frozenKeys.push_back(String(Frozen, name));
+        (*pLong)[mutableKeys.back()] = mutableKeys.back();
+    }
+
+    Measure("Dictionary long key lookup (mutable)", Rounds * Keys, Runs,
+            [&]() { Lookup(pLong, mutableKeys); });
+    Measure("Dictionary long key lookup (frozen)", Rounds * Keys, Runs,
+            [&]() { Lookup(pLong, frozenKeys); });
+
+    size_t flat = (*pFlat).capacity() * (sizeof(std::pair<ObjectPtr,
+        ObjectPtr>) + sizeof(size_t) + 1) / Keys;
+    size_t node = sizeof(std::pair<ObjectPtr, ObjectPtr>) + 2 * sizeof(void *)
+        + (*pNode).bucket_count() * sizeof(void *) / Keys;
+
+    std::printf("Table bytes per entry: flat %zu, node %zu\n", flat, node);
+
+    return 0;
+}
@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   BenchHash.cpp
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 18:10
+ */
+
+/// Internal libs includes
+#include "Benchmark.h"
+#include "dynobjects/Standard.h"
+#include "dynobjects/BasicTypes.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace DynObjects;
+
+namespace
+{
+    /// Benchmark configuration
+
+    const size_t Keys = 10000;
+    const size_t KeySize = 8;
+    const size_t Rounds = 20;
+    const size_t Runs = 5;
+    const size_t PayloadSize = 1024;
+    const size_t PayloadRounds = 100000;
+
+    /**
+     * Serializes a composite key into a string, as done before containers
+     * could be hashed
+     * @param values Composite key
+     * @return Serialized key
+     */
+    std::string Serialize(const std::vector<int> &values)
+    {
+        std::ostringstream ss;
+        for(int value : values)
+        {
+            ss << value << ',';
+        }
+        return ss.str();
+    }
+
+    /**
+     * Builds the composite keys
+     * @return List of keys
+     */
+    std::vector<std::vector<int>> BuildKeys()
+    {
+        std::vector<std::vector<int>> keys;
+
+        for(size_t i = 0; i < Keys; ++i)
+        {
+            std::vector<int> values;
+            for(size_t j = 0; j < KeySize; ++j)
+            {
+                values.push_back(static_cast<int>(i * KeySize + j));
+            }
+            keys.push_back(values);
+        }
+
+        return keys;
+    }
+}
+
+int main()
+{
+    const std::vector<std::vector<int>> keys = BuildKeys();
+
+    Dictionary pStructural;
+    Dictionary pSerialized;
+
+    for(const std::vector<int> &key : keys)
+    {
+        (*pStructural)[Vector<int>(key)] = Integer(1);
+        (*pSerialized)[String(Serialize(key))] = Integer(1);
+    }
+
+    Measure("Composite key lookup (structural)", Rounds * Keys, Runs, [&]()
+    {
+        for(size_t i = 0; i < Rounds; ++i)
+        {
+            for(const std::vector<int> &key : keys)
+            {
+                DoNotOptimize(&(*pStructural).find(Vector<int>(key))->second);
+            }
+        }
+    });
+
+    Measure("Composite key lookup (serialized)", Rounds * Keys, Runs, [&]()
+    {
+        for(size_t i = 0; i < Rounds; ++i)
+        {
+            for(const std::vector<int> &key : keys)
+            {
+                DoNotOptimize(
+                    &(*pSerialized).find(String(Serialize(key)))->second);
+            }
+        }
+    });
+
+    const std::string payload(PayloadSize, 'P');
+    const std::vector<double> numbers(PayloadSize / sizeof(double), 0.5);
+    const Vector<double> pNumbers(numbers);
+    const Vector<double> pOther(numbers);
+
+    Measure("1 KiB string hash (std::hash)", PayloadRounds, Runs, [&]()
+    {
+        for(size_t i = 0; i < PayloadRounds; ++i)
+        {
+            DoNotOptimize(std::hash<std::string>()(payload));
+        }
+    });
+
+    const char *levels[] = {"scalar", "sse2", "avx2"};
+    for(Kernels::Level level : {Kernels::Level::Scalar, Kernels::Level::SSE2,
+                                Kernels::Level::AVX2})
+    {
+        if(Kernels::SetLevel(level) != level)
+        {
+            continue;
+        }
+
+        std::string name = levels[static_cast<int>(level)];
+
+        Measure(("1 KiB string hash (" + name + ")").c_str(), PayloadRounds, Runs,
+                [&]()
+        {
+            for(size_t i = 0; i < PayloadRounds; ++i)
+            {
+                DoNotOptimize(Operators::Hash<std::string>()(payload));
+            }
+        });
+
+        Measure(("1 KiB Vector<double> compare (" + name + ")").c_str(),
+                PayloadRounds, Runs, [&]()
+        {
+            for(size_t i = 0; i < PayloadRounds; ++i)
+            {
+                DoNotOptimize(pNumbers.GetObject().compare(
+                    pOther.GetObject()));
+            }
+        });
+    }
+
+    return 0;
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   BenchRecord.cpp
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 20:45
+ */
+
+/// Internal libs includes
+#include "Benchmark.h"
+#include "dynobjects/Record.h"
+#include "dynobjects/Standard.h"
+#include "dynobjects/BasicTypes.h"
+
+/// External libs includes
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+// C++11 standard
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace DynObjects;
+
+namespace
+{
+    /// Benchmark configuration
+
+    const size_t Records = 100000;
+    const size_t Fields = 12;
+    const size_t Runs = 5;
+
+    typedef Map<std::string, ObjectPtr> StringMap;
+
+    /**
+     * Returns the number of bytes in use by the heap
+     * @return Bytes in use, or zero if unknown
+     */
+    size_t HeapInUse()
+    {
+#ifdef __GLIBC__
+        struct mallinfo2 info = mallinfo2();
+        return info.uordblks + info.hblkhd;
+#else
+        return 0;
+#endif
+    }
+
+    /**
+     * Field names, longer than the small string buffer as real ones
+     * @return Field names
+     */
+    std::vector<std::string> BuildNames()
+    {
+        std::vector<std::string> names;
+
+        for(size_t i = 0; i < Fields; ++i)
+        {
+            names.push_back("record_field_" + std::to_string(i));
+        }
+
+        return names;
+    }
+}
+
+int main()
+{
+    const std::vector<std::string> names = BuildNames();
+    const ObjectPtr value = Integer(1);
+
+    size_t before = HeapInUse();
+    std::vector<StringMap> maps;
+    maps.reserve(Records);
+    for(size_t i = 0; i < Records; ++i)
+    {
+        maps.emplace_back();
+        for(const std::string &name : names)
+        {
+            (*maps.back())[name] = value;
+        }
+    }
+    size_t mapBytes = HeapInUse() - before;
+
+    before = HeapInUse();
+    std::vector<RecordInstance> records;
+    records.reserve(Records);
+    for(size_t i = 0; i < Records; ++i)
+    {
+        records.emplace_back();
+        for(const std::string &name : names)
+        {
+            (*records.back()).Set(name, value);
+        }
+    }
+    size_t recordBytes = HeapInUse() - before;
+
+    std::printf("%-50s %10.1f bytes/record\n", "String map memory",
+                static_cast<double>(mapBytes) / Records);
+    std::printf("%-50s %10.1f bytes/record\n", "Record memory",
+                static_cast<double>(recordBytes) / Records);
+
+    const std::string &last = names.back();
+    static const FieldKey LastKey(last);
+
+    Measure("String map field lookup", Records, Runs, [&]()
+    {
+        for(const StringMap &map : maps)
+        {
+            DoNotOptimize(&(*map).at(last));
+        }
+    });
+
+    Measure("Record field lookup by name", Records, Runs, [&]()
+    {
+        for(const RecordInstance &record : records)
+        {
+            DoNotOptimize(&(*record).Get(last));
+        }
+    });
+
+    Measure("Record field lookup by cached key", Records, Runs, [&]()
+    {
+        for(const RecordInstance &record : records)
+        {
+            DoNotOptimize(&(*record).Get(LastKey));
+        }
+    });
+
+    return 0;
+}
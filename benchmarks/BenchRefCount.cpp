@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   BenchRefCount.cpp
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 12:40
+ */
+
+/// Internal libs includes
+#include "Benchmark.h"
+#include "dynobjects/Standard.h"
+#include "dynobjects/BasicTypes.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <string>
+#include <vector>
+
+using namespace DynObjects;
+
+namespace
+{
+    /// Benchmark configuration
+
+    const size_t Objects = 1000;
+    const size_t Rounds = 1000;
+    const size_t Runs = 5;
+
+    /**
+     * Builds a list of heap objects
+     * @return List of objects
+     */
+    std::vector<ObjectPtr> BuildObjects()
+    {
+        std::vector<ObjectPtr> objects;
+
+        for(size_t i = 0; i < Objects; ++i)
+        {
+            objects.push_back(String("VALUE_" + std::to_string(i)));
+        }
+
+        return objects;
+    }
+
+    /**
+     * Copies every object of the list many times
+     * @param objects List of objects
+     */
+    void CopyObjects(const std::vector<ObjectPtr> &objects)
+    {
+        for(size_t i = 0; i < Rounds; ++i)
+        {
+            std::vector<ObjectPtr> copy(objects);
+            DoNotOptimize(copy.data());
+        }
+    }
+
+    /**
+     * Reads a nested field through re-typed instances many times
+     * @param pContext Root of the graph
+     */
+    void ReadNested(const ObjectPtr &pContext)
+    {
+        typedef Map<std::string, ObjectPtr> StringMap;
+
+        for(size_t i = 0; i < Rounds * Objects; ++i)
+        {
+            StringMap pKeyStore = (*StringMap(pContext))["KEY_STORE"];
+            String pPrivate = (*pKeyStore)["PRIVATE"];
+            DoNotOptimize((*pPrivate).size());
+        }
+    }
+
+    /**
+     * Reads a nested field through borrowed references many times
+     * @param pContext Root of the graph
+     */
+    void ReadNestedBorrowed(const ObjectPtr &pContext)
+    {
+        typedef Map<std::string, ObjectPtr> StringMap;
+        typedef InstanceRef<StringMap::value_type, StringMap::object_type>
+            StringMapRef;
+        typedef InstanceRef<String::value_type, String::object_type>
+            StringRef;
+
+        for(size_t i = 0; i < Rounds * Objects; ++i)
+        {
+            StringMapRef pKeyStore((*StringMapRef(pContext)).at("KEY_STORE"));
+            StringRef pPrivate((*pKeyStore).at("PRIVATE"));
+            DoNotOptimize((*pPrivate).size());
+        }
+    }
+
+    /**
+     * Builds a nested graph
+     * @return Root of the graph
+     */
+    ObjectPtr BuildGraph()
+    {
+        typedef Map<std::string, ObjectPtr> StringMap;
+
+        StringMap pContext = StringMap();
+        StringMap pKeyStore = StringMap();
+
+        (*pKeyStore)["PRIVATE"] = String("PRIVATE");
+        (*pContext)["KEY_STORE"] = pKeyStore;
+
+        return pContext;
+    }
+}
+
+int main()
+{
+#if defined(DYNOBJECTS_NON_ATOMIC_REFCOUNT)
+    std::printf("Reference counting: intrusive, non-atomic\n");
+#elif defined(DYNOBJECTS_INTRUSIVE_REFCOUNT)
+    std::printf("Reference counting: intrusive\n");
+#else
+    std::printf("Reference counting: std::shared_ptr "
+                "(thread-confined scopes have no effect)\n");
+#endif
+
+    std::vector<ObjectPtr> shared = BuildObjects();
+    ObjectPtr pShared = BuildGraph();
+
+    std::vector<ObjectPtr> local;
+    ObjectPtr pLocal;
+
+    {
+        LocalRefCountScope scope;
+        local = BuildObjects();
+        pLocal = BuildGraph();
+    }
+
+    Measure("Copy heap instances (atomic)", Rounds * Objects, Runs,
+            [&]() { CopyObjects(shared); });
+    Measure("Copy heap instances (thread-confined)", Rounds * Objects, Runs,
+            [&]() { CopyObjects(local); });
+    Measure("Read nested field (atomic)", Rounds * Objects, Runs,
+            [&]() { ReadNested(pShared); });
+    Measure("Read nested field (thread-confined)", Rounds * Objects, Runs,
+            [&]() { ReadNested(pLocal); });
+    Measure("Read nested field (borrowed)", Rounds * Objects, Runs,
+            [&]() { ReadNestedBorrowed(pShared); });
+
+    return 0;
+}
@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   BenchText.cpp
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 22:15
+ */
+
+/// Internal libs includes
+#include "Benchmark.h"
+#include "dynobjects/ImmutableString.h"
+#include "dynobjects/Standard.h"
+
+/// External libs includes
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+// C++11 standard
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace DynObjects;
+
+namespace
+{
+    /// Benchmark configuration
+
+    const size_t Strings = 100000;
+    const size_t Runs = 5;
+
+    /**
+     * Returns the number of bytes in use by the heap
+     * @return Bytes in use, or zero if unknown
+     */
+    size_t HeapInUse()
+    {
+#ifdef __GLIBC__
+        struct mallinfo2 info = mallinfo2();
+        return info.uordblks + info.hblkhd;
+#else
+        return 0;
+#endif
+    }
+
+    /**
+     * Grows the heap once, its first growth is not representative
+     */
+    void WarmUp()
+    {
+        std::vector<void *> blocks;
+
+        for(size_t i = 0; i < Strings; ++i)
+        {
+            blocks.push_back(Allocator::Allocate(Allocator::MaxBlockSize));
+        }
+
+        for(void *block : blocks)
+        {
+            Allocator::Deallocate(block, Allocator::MaxBlockSize);
+        }
+    }
+
+    /**
+     * Builds string objects and returns the memory they take
+     * @param value Characters of every string
+     * @param objects Built objects, kept alive so freed blocks are not
+     * reused by the next measurement
+     * @return Bytes per string
+     */
+    template<typename _Instance>
+    double Build(const std::string &value, std::vector<ObjectPtr> &objects)
+    {
+        objects.reserve(Strings);
+
+        size_t before = HeapInUse();
+        for(size_t i = 0; i < Strings; ++i)
+        {
+            objects.push_back(_Instance(value));
+        }
+
+        return static_cast<double>(HeapInUse() - before) / Strings;
+    }
+}
+
+int main()
+{
+    WarmUp();
+
+    std::vector<ObjectPtr> strings[3];
+    std::vector<ObjectPtr> texts[3];
+    size_t index = 0;
+
+    for(size_t length : {8, 24, 100})
+    {
+        const std::string value(length, 'x');
+
+        double stringBytes = Build<String>(value, strings[index]);
+        double textBytes = Build<Text>(value, texts[index]);
+        ++index;
+
+        std::string name = std::to_string(length) + " characters, ";
+
+        std::printf("%-50s %10.1f bytes/string\n",
+                    (name + "String memory").c_str(), stringBytes);
+        std::printf("%-50s %10.1f bytes/string\n",
+                    (name + "Text memory").c_str(), textBytes);
+
+        Measure((name + "String construction").c_str(), Strings, Runs,
+                [&]()
+        {
+            for(size_t i = 0; i < Strings; ++i)
+            {
+                DoNotOptimize(String(value));
+            }
+        });
+
+        Measure((name + "Text construction").c_str(), Strings, Runs, [&]()
+        {
+            for(size_t i = 0; i < Strings; ++i)
+            {
+                DoNotOptimize(Text(value));
+            }
+        });
+
+        String pString(value);
+        Text pText(value);
+        std::hash<ObjectPtr> hasher;
+
+        Measure((name + "String hash").c_str(), Strings, Runs, [&]()
+        {
+            for(size_t i = 0; i < Strings; ++i)
+            {
+                DoNotOptimize(hasher(pString));
+            }
+        });
+
+        Measure((name + "Text hash").c_str(), Strings, Runs, [&]()
+        {
+            for(size_t i = 0; i < Strings; ++i)
+            {
+                DoNotOptimize(hasher(pText));
+            }
+        });
+    }
+
+    return 0;
+}
@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   BenchValue.cpp
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 23:00
+ */
+
+/// Internal libs includes
+#include "Benchmark.h"
+#include "dynobjects/BasicTypes.h"
+#include "dynobjects/ScalarValue.h"
+#include "dynobjects/Value.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <functional>
+#include <vector>
+
+using namespace DynObjects;
+
+namespace
+{
+    /// Benchmark configuration
+
+    const size_t Items = 1000000;
+    const size_t Runs = 5;
+}
+
+int main()
+{
+    std::vector<ObjectPtr> boxed;
+    std::vector<Value> values;
+    std::vector<ScalarValue> scalars;
+
+    boxed.reserve(Items);
+    values.reserve(Items);
+    scalars.reserve(Items);
+
+    for(size_t i = 0; i < Items; ++i)
+    {
+        int32_t item = static_cast<int32_t>(i % 1000);
+        boxed.push_back(Integer(item));
+        values.push_back(Value(item));
+        scalars.push_back(ScalarValue(item));
+    }
+
+    Measure("Sum boxed integers", Items, Runs, [&]()
+    {
+        int64_t sum = 0;
+        for(const ObjectPtr &item : boxed)
+        {
+            sum += *Integer(item);
+        }
+        DoNotOptimize(sum);
+    });
+
+    Measure("Sum values", Items, Runs, [&]()
+    {
+        Value sum(0);
+        for(const Value &item : values)
+        {
+            sum = sum + item;
+        }
+        DoNotOptimize(sum);
+    });
+
+    Measure("Sum scalar values", Items, Runs, [&]()
+    {
+        int64_t sum = 0;
+        for(const ScalarValue &item : scalars)
+        {
+            sum += item.Get<int32_t>();
+        }
+        DoNotOptimize(sum);
+    });
+
+    Measure("Hash boxed integers", Items, Runs, [&]()
+    {
+        std::hash<ObjectPtr> hasher;
+        size_t hash = 0;
+        for(const ObjectPtr &item : boxed)
+        {
+            hash ^= hasher(item);
+        }
+        DoNotOptimize(hash);
+    });
+
+    Measure("Hash values", Items, Runs, [&]()
+    {
+        size_t hash = 0;
+        for(const Value &item : values)
+        {
+            hash ^= item.hash();
+        }
+        DoNotOptimize(hash);
+    });
+
+    Measure("Hash scalar values", Items, Runs, [&]()
+    {
+        size_t hash = 0;
+        for(const ScalarValue &item : scalars)
+        {
+            hash ^= item.hash();
+        }
+        DoNotOptimize(hash);
+    });
+
+    Measure("Compare boxed integers", Items, Runs, [&]()
+    {
+        size_t count = 0;
+        for(size_t i = 1; i < Items; ++i)
+        {
+            count += *boxed[i - 1] < *boxed[i];
+        }
+        DoNotOptimize(count);
+    });
+
+    Measure("Compare values", Items, Runs, [&]()
+    {
+        size_t count = 0;
+        for(size_t i = 1; i < Items; ++i)
+        {
+            count += values[i - 1] < values[i];
+        }
+        DoNotOptimize(count);
+    });
+
+    Measure("Compare scalar values", Items, Runs, [&]()
+    {
+        size_t count = 0;
+        for(size_t i = 1; i < Items; ++i)
+        {
+            count += scalars[i - 1] < scalars[i];
+        }
+        DoNotOptimize(count);
+    });
+
+    Measure("Copy boxed integers", Items, Runs, [&]()
+    {
+        std::vector<ObjectPtr> copy(boxed);
+        DoNotOptimize(copy.data());
+    });
+
+    Measure("Copy values", Items, Runs, [&]()
+    {
+        std::vector<Value> copy(values);
+        DoNotOptimize(copy.data());
+    });
+
+    Measure("Copy scalar values", Items, Runs, [&]()
+    {
+        std::vector<ScalarValue> copy(scalars);
+        DoNotOptimize(copy.data());
+    });
+
+    return 0;
+}
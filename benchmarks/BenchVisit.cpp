@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   BenchVisit.cpp
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 23:50
+ */
+
+/// Internal libs includes
+#include "Benchmark.h"
+#include "dynobjects/Visitor.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <string>
+#include <vector>
+
+using namespace DynObjects;
+
+namespace
+{
+    /// Benchmark configuration
+
+    const size_t Objects = 100000;
+    const size_t Runs = 5;
+
+    /**
+     * Builds a list of objects of eight types, interleaved
+     * @return List of objects
+     */
+    std::vector<ObjectPtr> BuildObjects()
+    {
+        std::vector<ObjectPtr> objects;
+
+        for(size_t i = 0; i < Objects; ++i)
+        {
+            int value = static_cast<int>(i);
+
+            switch((i * 7919) % 8)
+            {
+                case 0: objects.push_back(Integer(value)); break;
+                case 1: objects.push_back(Long(value)); break;
+                case 2: objects.push_back(Double(value)); break;
+                case 3: objects.push_back(Float(value)); break;
+                case 4: objects.push_back(Boolean(value & 1)); break;
+                case 5: objects.push_back(Short(value & 0x7fff)); break;
+                case 6: objects.push_back(String(std::to_string(i))); break;
+                default: objects.push_back(Vector<ObjectPtr>()); break;
+            }
+        }
+
+        return objects;
+    }
+
+    /**
+     * Sizes an object, probing its type one cast at a time
+     * @param o Object
+     * @return Size of the object item
+     */
+    size_t ProbeSize(const Object &o)
+    {
+        if(dynamic_cast<const Integer::object_type *>(&o))
+        {
+            return sizeof(int);
+        }
+        else if(dynamic_cast<const Long::object_type *>(&o))
+        {
+            return sizeof(long);
+        }
+        else if(dynamic_cast<const Double::object_type *>(&o))
+        {
+            return sizeof(double);
+        }
+        else if(dynamic_cast<const Float::object_type *>(&o))
+        {
+            return sizeof(float);
+        }
+        else if(dynamic_cast<const Boolean::object_type *>(&o))
+        {
+            return sizeof(bool);
+        }
+        else if(dynamic_cast<const Short::object_type *>(&o))
+        {
+            return sizeof(short);
+        }
+        else if(const String::object_type *s =
+                dynamic_cast<const String::object_type *>(&o))
+        {
+            return s->GetValue().size();
+        }
+        else if(const Vector<ObjectPtr>::object_type *v =
+                dynamic_cast<const Vector<ObjectPtr>::object_type *>(&o))
+        {
+            return v->GetValue().size();
+        }
+
+        return 0;
+    }
+}
+
+int main()
+{
+    const std::vector<ObjectPtr> objects = BuildObjects();
+
+    auto size = Overload(
+        [](int) { return sizeof(int); },
+        [](long) { return sizeof(long); },
+        [](double) { return sizeof(double); },
+        [](float) { return sizeof(float); },
+        [](bool) { return sizeof(bool); },
+        [](short) { return sizeof(short); },
+        [](const std::string &s) { return s.size(); },
+        [](const std::vector<ObjectPtr> &v) { return v.size(); },
+        [](const Object &) { return size_t(0); });
+
+    Measure("Type probing with dynamic_cast", Objects, Runs, [&]()
+    {
+        size_t total = 0;
+        for(const ObjectPtr &o : objects)
+        {
+            total += ProbeSize(*o);
+        }
+        DoNotOptimize(total);
+    });
+
+    Measure("Type probing with GetObjectType", Objects, Runs, [&]()
+    {
+        size_t total = 0;
+        for(const ObjectPtr &o : objects)
+        {
+            const std::string type = (*o).GetObjectType();
+            total += type == "int" ? sizeof(int) : type.size();
+        }
+        DoNotOptimize(total);
+    });
+
+    Measure("Visit", Objects, Runs, [&]()
+    {
+        size_t total = 0;
+        for(const ObjectPtr &o : objects)
+        {
+            total += Visit(o, size);
+        }
+        DoNotOptimize(total);
+    });
+
+    auto add = Overload(
+        [](int a, int b) { return double(a + b); },
+        [](double a, double b) { return a + b; },
+        [](int a, double b) { return a + b; },
+        [](double a, int b) { return a + b; },
+        [](const Object &, const Object &) { return 0.0; });
+
+    Measure("Double dispatch Visit", Objects - 1, Runs, [&]()
+    {
+        double total = 0;
+        for(size_t i = 1; i < objects.size(); ++i)
+        {
+            total += Visit(objects[i - 1], objects[i], add);
+        }
+        DoNotOptimize(total);
+    });
+
+    return 0;
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   Benchmark.h
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 12:40
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+/// External libs includes
+
+// C++11 standard
+#include <chrono>
+#include <cstdio>
+
+
+/**
+ * Prevents the compiler from optimizing away a value
+ * @param value Value to keep
+ */
+template<typename T>
+inline void DoNotOptimize(const T &value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * Runs a benchmark and prints the time per operation
+ * @param name Benchmark name
+ * @param operations Number of operations performed by each run
+ * @param runs Number of runs, the fastest one is reported
+ * @param fn Benchmark body
+ * @return Nanoseconds per operation
+ */
+template<typename Fn>
+inline double Measure(const char *name, size_t operations, size_t runs, Fn fn)
+{
+    double best = 0;
+
+    for(size_t i = 0; i < runs; ++i)
+    {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto end = std::chrono::steady_clock::now();
+
+        double elapsed = std::chrono::duration<double, std::nano>(
+            end - start).count() / operations;
+
+        if(i == 0 || elapsed < best)
+        {
+            best = elapsed;
+        }
+    }
+
+    std::printf("%-48s %10.2f ns/op\n", name, best);
+    return best;
+}
+
+#endif /* BENCHMARK_H */
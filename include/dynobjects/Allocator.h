@@ -0,0 +1,341 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   Allocator.h
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 13:05
+ */
+
+#ifndef DYNOBJECTS_ALLOCATOR_H
+#define DYNOBJECTS_ALLOCATOR_H
+
+/// External libs includes
+
+// C++11 standard
+#include <cstddef>
+#include <new>
+
+
+/**
+ * DynObjects library namespace
+ */
+namespace DynObjects
+{
+    /**
+     * Dynamic objects allocator
+     * @note Small blocks come from size-class pools with thread-local caches,
+     * or from the arena of the current thread (see ArenaScope). Everything
+     * goes to the global allocator when the library is built without
+     * DYNOBJECTS_POOL_ALLOCATOR
+     */
+    class Allocator
+    {
+    public:
+        /**
+         * Size of the biggest block served by the pools
+         */
+        static const size_t MaxBlockSize = 256;
+
+        /**
+         * Allocates a block
+         * @param size Block size
+         * @return Pointer to the block, aligned to 16 bytes
+         * @throw std::bad_alloc If there is no memory available
+         */
+        static void *Allocate(size_t size);
+
+        /**
+         * Deallocates a block
+         * @param ptr Pointer to the block
+         * @param size Block size, as requested on allocation
+         */
+        static void Deallocate(void *ptr, size_t size);
+    };
+
+    /**
+     * Arena allocation scope
+     * @note Small blocks allocated by the current thread while the scope is
+     * alive come from the arena and are all freed at once when the scope
+     * ends. Deallocating them before is a no-op. Objects allocated in the
+     * arena must be released before the scope ends
+     */
+    class ArenaScope
+    {
+    public:
+        /// Class constructors
+
+        /**
+         * Class constructor
+         */
+        ArenaScope();
+
+        /**
+         * Class destructor
+         */
+        ~ArenaScope();
+
+        /// Class implementations
+
+        /**
+         * Allocates a block from the arena
+         * @param size Block size
+         * @return Pointer to the block, aligned to 16 bytes
+         */
+        void *Allocate(size_t size);
+
+        /**
+         * Returns the number of bytes allocated from the arena
+         * @return Allocated bytes
+         */
+        inline size_t GetSize() const
+        {
+            return this->m_Size;
+        }
+
+        /**
+         * Returns the innermost arena of the current thread
+         * @return Current arena, or null if there is none
+         */
+        static ArenaScope *GetCurrent();
+
+    private:
+        /// Class helpers
+
+        /**
+         * Prevents the use of the copy constructor
+         */
+        ArenaScope(const ArenaScope &) = delete;
+
+        /**
+         * Prevents the use of the copy operator
+         */
+        void operator=(const ArenaScope &) = delete;
+
+        /// Class attributes
+
+        /**
+         * Enclosing arena
+         */
+        ArenaScope *m_Previous;
+
+        /**
+         * Chunks owned by the arena, chained through their headers
+         */
+        void *m_Chunks;
+
+        /**
+         * Next free byte of the current chunk
+         */
+        char *m_Next;
+
+        /**
+         * End of the current chunk
+         */
+        char *m_End;
+
+        /**
+         * Allocated bytes
+         */
+        size_t m_Size;
+    };
+
+    /**
+     * Standard allocator adaptor for the dynamic objects allocator
+     */
+    template<typename T>
+    class PoolAllocator
+    {
+    public:
+        /// Types definitions
+
+        typedef T value_type;
+
+        template<typename U>
+        struct rebind
+        {
+            typedef PoolAllocator<U> other;
+        };
+
+        /// Class constructors
+
+        /**
+         * Class default constructor
+         */
+        PoolAllocator() = default;
+
+        /**
+         * Class conversion constructor
+         */
+        template<typename U>
+        PoolAllocator(const PoolAllocator<U> &)
+        {
+        }
+
+        /// Class implementations
+
+        /**
+         * Allocates storage for n items
+         * @param n Number of items
+         * @return Pointer to the storage
+         */
+        inline T *allocate(size_t n)
+        {
+            return static_cast<T *>(Allocator::Allocate(n * sizeof(T)));
+        }
+
+        /**
+         * Deallocates storage of n items
+         * @param ptr Pointer to the storage
+         * @param n Number of items
+         */
+        inline void deallocate(T *ptr, size_t n)
+        {
+            Allocator::Deallocate(ptr, n * sizeof(T));
+        }
+    };
+
+    template<typename T, typename U>
+    inline bool operator==(const PoolAllocator<T> &, const PoolAllocator<U> &)
+    {
+        return true;
+    }
+
+    template<typename T, typename U>
+    inline bool operator!=(const PoolAllocator<T> &, const PoolAllocator<U> &)
+    {
+        return false;
+    }
+
+    /**
+     * Standard allocator adaptor adding trailing bytes to every allocation
+     * @note Lets std::allocate_shared place variable size data in the same
+     * block as the object and its control block. Where the trailing bytes
+     * start is recorded at allocation, so their place does not depend on
+     * the layout of the control block
+     */
+    template<typename T>
+    class TrailingAllocator
+    {
+    public:
+        /// Types definitions
+
+        typedef T value_type;
+
+        template<typename U>
+        struct rebind
+        {
+            typedef TrailingAllocator<U> other;
+        };
+
+        /// Class constructors
+
+        /**
+         * Class constructor
+         * @param extra Number of bytes added to every allocation
+         * @param trailing Where to record the start of the trailing bytes
+         */
+        TrailingAllocator(size_t extra, void **trailing) :
+        m_Extra(extra), m_Trailing(trailing)
+        {
+        }
+
+        /**
+         * Class conversion constructor
+         */
+        template<typename U>
+        TrailingAllocator(const TrailingAllocator<U> &o) :
+        m_Extra(o.GetExtra()), m_Trailing(o.GetTrailing())
+        {
+        }
+
+        /// Class implementations
+
+        /**
+         * Allocates storage for n items and the trailing bytes
+         * @param n Number of items
+         * @return Pointer to the storage
+         */
+        inline T *allocate(size_t n)
+        {
+            char *ptr = static_cast<char *>(
+                Allocator::Allocate(n * sizeof(T) + this->m_Extra));
+            *this->m_Trailing = ptr + n * sizeof(T);
+            return reinterpret_cast<T *>(ptr);
+        }
+
+        /**
+         * Deallocates storage of n items and the trailing bytes
+         * @param ptr Pointer to the storage
+         * @param n Number of items
+         */
+        inline void deallocate(T *ptr, size_t n)
+        {
+            Allocator::Deallocate(ptr, n * sizeof(T) + this->m_Extra);
+        }
+
+        /**
+         * Returns the number of trailing bytes
+         * @return Number of bytes added to every allocation
+         */
+        inline size_t GetExtra() const
+        {
+            return this->m_Extra;
+        }
+
+        /**
+         * Returns where the start of the trailing bytes is recorded
+         * @return Pointer to the recorded start
+         */
+        inline void **GetTrailing() const
+        {
+            return this->m_Trailing;
+        }
+
+    private:
+        /// Class attributes
+
+        /**
+         * Number of bytes added to every allocation
+         */
+        size_t m_Extra;
+
+        /**
+         * Where the start of the trailing bytes of the last allocation is
+         * recorded
+         */
+        void **m_Trailing;
+    };
+
+    template<typename T, typename U>
+    inline bool operator==(const TrailingAllocator<T> &a,
+                           const TrailingAllocator<U> &b)
+    {
+        return a.GetExtra() == b.GetExtra();
+    }
+
+    template<typename T, typename U>
+    inline bool operator!=(const TrailingAllocator<T> &a,
+                           const TrailingAllocator<U> &b)
+    {
+        return a.GetExtra() != b.GetExtra();
+    }
+}
+
+#endif /* DYNOBJECTS_ALLOCATOR_H */
+
@@ -0,0 +1,242 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   Atom.h
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 21:30
+ */
+
+#ifndef DYNOBJECTS_ATOM_H
+#define DYNOBJECTS_ATOM_H
+
+/// Internal libs includes
+#include "Basic.h"
+#include "Standard.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+
+
+/**
+ * DynObjects library namespace
+ */
+namespace DynObjects
+{
+    /**
+     * Interned string
+     * @note Symbols with the same name share a single entry of the process
+     * intern table, so they are equal if and only if they point to the
+     * same entry and their hash is computed once. Entries are never
+     * destroyed. Lookups do not lock, interning new names locks one shard
+     * of the table
+     */
+    class Symbol
+    {
+    public:
+        /**
+         * Intern table entry
+         */
+        struct Entry
+        {
+            /**
+             * Hash of the name, as the one of the string holding it
+             */
+            size_t Hash;
+
+            /**
+             * Symbol name
+             */
+            std::string Name;
+        };
+
+        /// Class constructors
+
+        /**
+         * Class default constructor, the empty symbol
+         */
+        Symbol();
+
+        /**
+         * Class constructor, interns the name if needed
+         * @param name Symbol name
+         */
+        Symbol(const std::string &name) : m_Entry(Intern(name))
+        {
+        }
+
+        /**
+         * Class constructor, interns the name if needed
+         * @param name Symbol name
+         */
+        Symbol(const char *name) : m_Entry(Intern(name))
+        {
+        }
+
+        /// Class operators
+
+        inline bool operator==(const Symbol &o) const
+        {
+            return this->m_Entry == o.m_Entry;
+        }
+
+        inline bool operator!=(const Symbol &o) const
+        {
+            return this->m_Entry != o.m_Entry;
+        }
+
+        inline bool operator<(const Symbol &o) const
+        {
+            return this->compare(o) < 0;
+        }
+
+        /// Class implementations
+
+        /**
+         * Three-way comparison method
+         * @param o Symbol to compare with
+         * @return Negative, zero or positive as the name of the symbol is
+         * less, equal or greater than the one of o
+         */
+        inline int compare(const Symbol &o) const
+        {
+            return this->m_Entry == o.m_Entry ? 0 :
+                this->m_Entry->Name.compare(o.m_Entry->Name);
+        }
+
+        /**
+         * Returns the symbol name
+         * @return Symbol name
+         */
+        inline const std::string &GetName() const
+        {
+            return this->m_Entry->Name;
+        }
+
+        /**
+         * Returns the hash of the symbol
+         * @return Hash of the name
+         */
+        inline size_t GetHash() const
+        {
+            return this->m_Entry->Hash;
+        }
+
+        /**
+         * Finds an already interned symbol
+         * @param name Symbol name
+         * @param symbol Found symbol, untouched if there is none
+         * @return Whether or not the name was interned
+         */
+        static bool Find(const std::string &name, Symbol &symbol);
+
+        /**
+         * Returns the number of interned symbols
+         * @return Number of intern table entries
+         */
+        static size_t GetCount();
+
+    private:
+        /// Class helpers
+
+        /**
+         * Class constructor from an intern table entry
+         * @param entry Intern table entry
+         * @note constexpr makes symbols literal types, see ScalarValue
+         */
+        explicit constexpr Symbol(const Entry *entry) : m_Entry(entry)
+        {
+        }
+
+        /**
+         * Returns the intern table entry of a name, adding it if needed
+         * @param name Symbol name
+         * @return Intern table entry
+         */
+        static const Entry *Intern(const std::string &name);
+
+        /// Class attributes
+
+        /**
+         * Intern table entry
+         */
+        const Entry *m_Entry;
+    };
+
+    /**
+     * Symbols are stored inline, they are a single pointer
+     */
+    template<>
+    struct InlineStorable<Basic<Symbol>> : public std::true_type
+    {
+    };
+
+    // Atom class, an interned string object
+    typedef BasicInstance<Symbol> Atom;
+
+    // Raw symbol keys, boxed as atoms
+    template<>
+    struct RawKey<Symbol, void>
+    {
+        typedef Basic<Symbol> type;
+
+        static inline size_t Hash(const Symbol &key)
+        {
+            return key.GetHash();
+        }
+
+        static inline bool Equals(const type &o, const Symbol &key)
+        {
+            return *o == key;
+        }
+    };
+}
+
+/**
+ * Stream operator for symbols
+ * @param os Output stream
+ * @param item Symbol to write to the stream
+ * @return Modified stream
+ */
+inline std::ostream &operator<<(std::ostream &os,
+                                const DynObjects::Symbol &item)
+{
+    return os << item.GetName();
+}
+
+
+// Hash implementation
+namespace std
+{
+    template<>
+    struct hash<DynObjects::Symbol>
+    {
+        size_t operator()(const DynObjects::Symbol &__s) const noexcept
+        {
+            return __s.GetHash();
+        }
+    };
+}
+
+#endif /* DYNOBJECTS_ATOM_H */
+
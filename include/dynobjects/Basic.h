@@ -34,6 +34,7 @@
 
 // C++11 standard
 #include <ostream>
+#include <utility>
 
 
 /**
@@ -45,7 +46,7 @@ namespace DynObjects
      * Basic object class
      */
     template<typename T>
-    class Basic : public virtual Object
+    class Basic final : public StaticObject<Basic<T>>
     {
     public:
         /// Class constructors
@@ -53,7 +54,7 @@ namespace DynObjects
         /**
          * Class default constructor
          */
-        Basic()
+        Basic() : StaticObject<Basic>(GetTypeId<Basic>())
         {
         }
 
@@ -61,10 +62,32 @@ namespace DynObjects
          * Class constructor
          * @param o
          */
-        Basic(const T &o) : m_Data(o)
+        Basic(const T &o) : StaticObject<Basic>(GetTypeId<Basic>()),
+        m_Data(o)
         {
         }
 
+        /**
+         * Class move constructor from the contained item
+         * @param o Item to move
+         */
+        Basic(T &&o) : StaticObject<Basic>(GetTypeId<Basic>()),
+        m_Data(std::move(o))
+        {
+        }
+
+        /**
+         * Class copy constructor
+         * @param o Object to copy
+         */
+        Basic(const Basic &o) = default;
+
+        /**
+         * Class move constructor
+         * @param o Object to move
+         */
+        Basic(Basic &&o) = default;
+
         /**
          * Class destructor
          */
@@ -104,84 +127,69 @@ namespace DynObjects
         }
 
         /**
-         * Non equalty comparison operator
-         * @param o Object to compare
-         * @return Result of the comparison
+         * Move assignation operator
+         * @param o Item to be moved
+         * @return A reference to itself
          */
-        virtual bool operator!=(const Object &o) const
+        Basic &operator=(T &&o)
         {
-            return this->m_Data != dynamic_cast<const Basic &>(o).m_Data;
+            this->m_Data = std::move(o);
+            return *this;
         }
 
         /**
-         * Equalty comparison operator
-         * @param o Object to compare
-         * @return Result of the comparison
+         * Copy assignation operator
+         * @param o Object to be assigned
+         * @return A reference to itself
          */
-        virtual bool operator==(const Object &o) const
-        {
-            return this->m_Data == dynamic_cast<const Basic &>(o).m_Data;
-        }
+        Basic &operator=(const Basic &o) = default;
 
         /**
-         * Less than comparison operator
-         * @param o Object to compare
-         * @return Result of the comparison
+         * Move assignation operator
+         * @param o Object to be moved
+         * @return A reference to itself
          */
-        virtual bool operator<(const Object &o) const
-        {
-            return this->m_Data < dynamic_cast<const Basic &>(o).m_Data;
-        }
+        Basic &operator=(Basic &&o) = default;
 
-        /**
-         * Greater than comparison operator
-         * @param o Object to compare
-         * @return Result of the comparison
-         */
-        virtual bool operator>(const Object &o) const
+        /// Class implementations
+
+        virtual std::string GetObjectType() const
         {
-            return this->m_Data > dynamic_cast<const Basic &>(o).m_Data;
+            return GetTypeInfo<Basic>().GetName();
         }
 
         /**
-         * Less or equal than comparison operator
-         * @param o Object to compare
-         * @return Result of the comparison
+         * Three-way comparison of two basic objects, see StaticObject
+         * @param a Object A
+         * @param b Object B
+         * @return Ordering of a relative to b
          */
-        virtual bool operator<=(const Object &o) const
+        static inline Ordering Compare(const Basic &a, const Basic &b)
         {
-            return this->m_Data <= dynamic_cast<const Basic &>(o).m_Data;
+            return Operators::ThreeWay<T>::Compare(a.m_Data, b.m_Data);
         }
 
         /**
-         * Greater or equal than comparison operator
-         * @param o Object to compare
-         * @return Result of the comparison
+         * Total order of two basic objects, see StaticObject
+         * @param a Object A
+         * @param b Object B
+         * @return Ordering of a relative to b, never unordered
          */
-        virtual bool operator>=(const Object &o) const
+        static inline Ordering TotalOrder(const Basic &a, const Basic &b)
         {
-            return this->m_Data >= dynamic_cast<const Basic &>(o).m_Data;
-        }
-
-
-        /// Class implementations
-
-        virtual std::string GetObjectType() const
-        {
-            return DemangleObjectName(typeid(T).name());
+            return Operators::TotalOrder<T>::Compare(a.m_Data, b.m_Data);
         }
 
         /**
-         * Hashing method
+         * Hashing method, see StaticObject
          * @return Hash of the object
          */
-        virtual size_t hash() const
+        inline size_t Hash() const
         {
             return Operators::Hash<T>()(this->m_Data);
         }
 
-    protected:
-
+    private:
         /// Class attributes
 
         /**
@@ -190,6 +198,23 @@ namespace DynObjects
         T m_Data;
     };
 
+    /**
+     * Basic objects value type
+     */
+    template<typename T>
+    struct ValueTypeOf<Basic<T>>
+    {
+        typedef T type;
+    };
+
+    /**
+     * Scalar basic objects are stored inline
+     */
+    template<typename T>
+    struct InlineStorable<Basic<T>> : public std::is_arithmetic<T>
+    {
+    };
+
     /**
      * Basic instances alias
      */
@@ -0,0 +1,1392 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   FlatHashMap.h
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 15:40
+ */
+
+#ifndef DYNOBJECTS_FLAT_HASH_MAP_H
+#define DYNOBJECTS_FLAT_HASH_MAP_H
+
+/// External libs includes
+
+// C++11 standard
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// SSE2 intrinsics
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+
+/**
+ * DynObjects library namespace
+ */
+namespace DynObjects
+{
+    /**
+     * Flat hash map internals
+     */
+    namespace FlatHash
+    {
+        /**
+         * Control byte of a slot
+         * @note Full slots hold the 7 low bits of the hash of their key
+         */
+        typedef int8_t Control;
+
+        /**
+         * Control byte of empty slots
+         */
+        const Control Empty = -128;
+
+        /**
+         * Control byte of erased slots
+         */
+        const Control Deleted = -2;
+
+        /**
+         * Control byte marking the end of the slots
+         */
+        const Control Sentinel = -1;
+
+        /**
+         * Number of control bytes probed at once
+         */
+        const size_t GroupWidth = 16;
+
+        /**
+         * Returns the control bytes of a table without slots
+         * @return Sentinel followed by empty control bytes
+         */
+        inline Control *EmptyGroup()
+        {
+            alignas(16) static Control group[GroupWidth] = {
+                Sentinel, Empty, Empty, Empty, Empty, Empty, Empty, Empty,
+                Empty, Empty, Empty, Empty, Empty, Empty, Empty, Empty
+            };
+
+            return group;
+        }
+
+        /**
+         * Spreads the entropy of a hash over all of its bits
+         * @param hash Hash of a key
+         * @return Mixed hash
+         * @note Identity hashes, such as the ones of integers, would
+         * otherwise land in the same probe group
+         */
+        inline size_t Mix(size_t hash)
+        {
+#if defined(__SIZEOF_INT128__) && SIZE_MAX == UINT64_MAX
+            __uint128_t product = static_cast<__uint128_t>(hash) *
+                UINT64_C(0x9E3779B97F4A7C15);
+            return static_cast<size_t>(product) ^
+                static_cast<size_t>(product >> 64);
+#else
+            hash ^= hash >> 16;
+            hash *= 0x45d9f3b;
+            hash ^= hash >> 16;
+            return hash;
+#endif
+        }
+
+        /**
+         * Returns the probe start of a hash
+         * @param hash Mixed hash
+         * @return Probe start, before masking
+         */
+        inline size_t H1(size_t hash)
+        {
+            return hash >> 7;
+        }
+
+        /**
+         * Returns the control byte of a hash
+         * @param hash Mixed hash
+         * @return Control byte
+         */
+        inline Control H2(size_t hash)
+        {
+            return static_cast<Control>(hash & 0x7F);
+        }
+
+        /**
+         * Set of positions inside a group
+         */
+        class BitMask
+        {
+        public:
+            /// Class constructors
+
+            /**
+             * Class constructor
+             * @param mask One bit per position
+             */
+            explicit inline BitMask(uint32_t mask) : m_Mask(mask)
+            {
+            }
+
+            /// Class operators
+
+            /**
+             * Whether or not there are positions left
+             */
+            explicit inline operator bool() const
+            {
+                return this->m_Mask != 0;
+            }
+
+            /// Class implementations
+
+            /**
+             * Returns the lowest position
+             * @return Lowest position
+             */
+            inline size_t Lowest() const
+            {
+                return static_cast<size_t>(__builtin_ctz(this->m_Mask));
+            }
+
+            /**
+             * Removes the lowest position
+             */
+            inline void Next()
+            {
+                this->m_Mask &= this->m_Mask - 1;
+            }
+
+        private:
+            /// Class attributes
+
+            /**
+             * One bit per position
+             */
+            uint32_t m_Mask;
+        };
+
+        /**
+         * Group of control bytes, probed with SSE2 when available
+         */
+        class Group
+        {
+        public:
+            /// Class constructors
+
+            /**
+             * Class constructor
+             * @param ctrl First control byte of the group
+             */
+            explicit inline Group(const Control *ctrl)
+            {
+#ifdef __SSE2__
+                this->m_Ctrl = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i *>(ctrl));
+#else
+                for(size_t i = 0; i < GroupWidth; ++i)
+                {
+                    this->m_Ctrl[i] = ctrl[i];
+                }
+#endif
+            }
+
+            /// Class implementations
+
+            /**
+             * Returns the positions holding a control byte
+             * @param hash Control byte to look for
+             * @return Matching positions
+             */
+            inline BitMask Match(Control hash) const
+            {
+#ifdef __SSE2__
+                return BitMask(static_cast<uint32_t>(_mm_movemask_epi8(
+                    _mm_cmpeq_epi8(_mm_set1_epi8(hash), this->m_Ctrl))));
+#else
+                uint32_t mask = 0;
+                for(size_t i = 0; i < GroupWidth; ++i)
+                {
+                    mask |= static_cast<uint32_t>(this->m_Ctrl[i] == hash) << i;
+                }
+                return BitMask(mask);
+#endif
+            }
+
+            /**
+             * Returns the empty positions
+             * @return Empty positions
+             */
+            inline BitMask MatchEmpty() const
+            {
+                return this->Match(Empty);
+            }
+
+            /**
+             * Returns the empty or erased positions
+             * @return Empty or erased positions
+             */
+            inline BitMask MatchEmptyOrDeleted() const
+            {
+#ifdef __SSE2__
+                return BitMask(static_cast<uint32_t>(_mm_movemask_epi8(
+                    _mm_cmpgt_epi8(_mm_set1_epi8(Sentinel), this->m_Ctrl))));
+#else
+                uint32_t mask = 0;
+                for(size_t i = 0; i < GroupWidth; ++i)
+                {
+                    mask |= static_cast<uint32_t>(this->m_Ctrl[i] < Sentinel) << i;
+                }
+                return BitMask(mask);
+#endif
+            }
+
+        private:
+            /// Class attributes
+
+            /**
+             * Control bytes
+             */
+#ifdef __SSE2__
+            __m128i m_Ctrl;
+#else
+            Control m_Ctrl[GroupWidth];
+#endif
+        };
+
+        /**
+         * Smallest number of slots of a table
+         */
+        const size_t MinCapacity = 3;
+
+        /**
+         * Returns the maximum number of items of a capacity
+         * @param capacity Number of slots
+         * @return Maximum number of items, keeps 1/8 of the slots and at
+         * least one of them empty so probing always ends
+         */
+        inline size_t CapacityToGrowth(size_t capacity)
+        {
+            return capacity - (capacity < 16 ? 1 : capacity / 8);
+        }
+
+        /**
+         * Returns the capacity needed to hold a number of items
+         * @param size Number of items
+         * @return Number of slots, a power of two minus one
+         */
+        inline size_t GrowthToCapacity(size_t size)
+        {
+            size_t capacity = MinCapacity;
+            while(CapacityToGrowth(capacity) < size)
+            {
+                capacity = capacity * 2 + 1;
+            }
+            return capacity;
+        }
+
+        template<typename...>
+        struct Void
+        {
+            typedef void type;
+        };
+
+        /**
+         * Transparent lookup check
+         * @note Keys of other types can be looked up when both the hash
+         * function and the key comparator declare is_transparent, as in
+         * C++20 unordered containers
+         */
+        template<typename _Hash, typename _Pred, typename = void>
+        struct IsTransparent : public std::false_type {};
+
+        template<typename _Hash, typename _Pred>
+        struct IsTransparent<_Hash, _Pred, typename Void<
+            typename _Hash::is_transparent,
+            typename _Pred::is_transparent>::type> : public std::true_type {};
+    }
+
+    /**
+     * Open-addressing hash map
+     * @note Items live in a flat array of slots next to the full hash of
+     * their key, and are found by probing groups of 7-bit control bytes.
+     * Unlike std::unordered_map, inserting may move every item: iterators,
+     * pointers and references are invalidated whenever the table grows,
+     * and iterators are also invalidated by erase
+     */
+    template<typename _Key, typename _Tp,
+             typename _Hash = std::hash<_Key>,
+             typename _Pred = std::equal_to<_Key>,
+             typename _Alloc = std::allocator<std::pair<const _Key, _Tp>>>
+    class FlatHashMap
+    {
+    public:
+        /// Types definitions
+
+        typedef _Key key_type;
+        typedef _Tp mapped_type;
+        typedef std::pair<const _Key, _Tp> value_type;
+        typedef size_t size_type;
+        typedef ptrdiff_t difference_type;
+        typedef _Hash hasher;
+        typedef _Pred key_equal;
+        typedef _Alloc allocator_type;
+        typedef value_type &reference;
+        typedef const value_type &const_reference;
+
+    private:
+        /**
+         * Slot, the item next to the mixed hash of its key
+         */
+        struct Slot
+        {
+            size_t Hash;
+            value_type Value;
+        };
+
+        typedef typename std::allocator_traits<_Alloc>::template
+            rebind_alloc<Slot> SlotAllocator;
+        typedef typename std::allocator_traits<_Alloc>::template
+            rebind_alloc<FlatHash::Control> ControlAllocator;
+
+    public:
+        /**
+         * Items iterator
+         */
+        template<bool _Const>
+        class Iterator
+        {
+        public:
+            /// Types definitions
+
+            typedef std::forward_iterator_tag iterator_category;
+            typedef typename FlatHashMap::value_type value_type;
+            typedef ptrdiff_t difference_type;
+            typedef typename std::conditional<_Const,
+                const value_type *, value_type *>::type pointer;
+            typedef typename std::conditional<_Const,
+                const value_type &, value_type &>::type reference;
+
+            /// Class constructors
+
+            /**
+             * Class default constructor
+             */
+            inline Iterator() : m_Ctrl(nullptr), m_Slot(nullptr)
+            {
+            }
+
+            /**
+             * Class constructor
+             * @param ctrl Control byte of the slot
+             * @param slot Slot
+             */
+            inline Iterator(const FlatHash::Control *ctrl, Slot *slot) :
+            m_Ctrl(ctrl), m_Slot(slot)
+            {
+            }
+
+            /**
+             * Class conversion constructor to a constant iterator
+             * @param o Iterator to convert
+             */
+            template<bool _OtherConst, typename = typename std::enable_if<
+                _Const && !_OtherConst>::type>
+            inline Iterator(const Iterator<_OtherConst> &o) :
+            m_Ctrl(o.m_Ctrl), m_Slot(o.m_Slot)
+            {
+            }
+
+            /// Class operators
+
+            inline reference operator*() const
+            {
+                return this->m_Slot->Value;
+            }
+
+            inline pointer operator->() const
+            {
+                return &this->m_Slot->Value;
+            }
+
+            inline Iterator &operator++()
+            {
+                ++this->m_Ctrl;
+                ++this->m_Slot;
+                this->SkipEmpty();
+                return *this;
+            }
+
+            inline Iterator operator++(int)
+            {
+                Iterator previous(*this);
+                ++*this;
+                return previous;
+            }
+
+            inline bool operator==(const Iterator &o) const
+            {
+                return this->m_Ctrl == o.m_Ctrl;
+            }
+
+            inline bool operator!=(const Iterator &o) const
+            {
+                return this->m_Ctrl != o.m_Ctrl;
+            }
+
+        private:
+            friend class FlatHashMap;
+
+            template<bool>
+            friend class Iterator;
+
+            /// Class helpers
+
+            /**
+             * Moves forward to the next full slot or the sentinel
+             */
+            inline void SkipEmpty()
+            {
+                while(*this->m_Ctrl < FlatHash::Sentinel)
+                {
+                    ++this->m_Ctrl;
+                    ++this->m_Slot;
+                }
+            }
+
+            /// Class attributes
+
+            /**
+             * Control byte of the slot
+             */
+            const FlatHash::Control *m_Ctrl;
+
+            /**
+             * Slot
+             */
+            Slot *m_Slot;
+        };
+
+        typedef Iterator<false> iterator;
+        typedef Iterator<true> const_iterator;
+
+
+        /// Class constructors
+
+        /**
+         * Class constructor
+         * @param capacity Number of items to reserve room for
+         * @param hash Hash function
+         * @param equal Key equality function
+         * @param alloc Allocator
+         */
+        explicit FlatHashMap(size_t capacity = 0, const _Hash &hash = _Hash(),
+                             const _Pred &equal = _Pred(),
+                             const _Alloc &alloc = _Alloc()) :
+        m_Ctrl(FlatHash::EmptyGroup()), m_Slots(nullptr), m_Size(0),
+        m_Capacity(0), m_Growth(0), m_Hash(hash), m_Equal(equal),
+        m_Alloc(alloc)
+        {
+            this->reserve(capacity);
+        }
+
+        /**
+         * Class constructor from a list of items
+         * @param items List of items
+         */
+        FlatHashMap(std::initializer_list<value_type> items) : FlatHashMap()
+        {
+            this->reserve(items.size());
+            for(const value_type &item : items)
+            {
+                this->insert(item);
+            }
+        }
+
+        /**
+         * Class constructor from a range of items
+         * @param first First item
+         * @param last End of the items
+         */
+        template<typename _InputIterator>
+        FlatHashMap(_InputIterator first, _InputIterator last) : FlatHashMap()
+        {
+            for(; first != last; ++first)
+            {
+                this->insert(*first);
+            }
+        }
+
+        /**
+         * Class copy constructor
+         * @param o Map to copy
+         */
+        FlatHashMap(const FlatHashMap &o) :
+        FlatHashMap(0, o.m_Hash, o.m_Equal, o.m_Alloc)
+        {
+            this->reserve(o.m_Size);
+            for(const_iterator it = o.begin(); it != o.end(); ++it)
+            {
+                this->EmplaceAt(this->FindNonFull(it.m_Slot->Hash),
+                                it.m_Slot->Hash, it->first, it->second);
+            }
+        }
+
+        /**
+         * Class move constructor
+         * @param o Map to move, left empty
+         */
+        FlatHashMap(FlatHashMap &&o) noexcept :
+        m_Ctrl(o.m_Ctrl), m_Slots(o.m_Slots), m_Size(o.m_Size),
+        m_Capacity(o.m_Capacity), m_Growth(o.m_Growth),
+        m_Hash(std::move(o.m_Hash)), m_Equal(std::move(o.m_Equal)),
+        m_Alloc(std::move(o.m_Alloc))
+        {
+            o.Forget();
+        }
+
+        /**
+         * Class destructor
+         */
+        ~FlatHashMap()
+        {
+            this->Release();
+        }
+
+        /// Class operators
+
+        /**
+         * Copy assignation operator
+         * @param o Map to copy
+         * @return A reference to itself
+         */
+        FlatHashMap &operator=(const FlatHashMap &o)
+        {
+            if(this != &o)
+            {
+                FlatHashMap copy(o);
+                this->swap(copy);
+            }
+            return *this;
+        }
+
+        /**
+         * Move assignation operator
+         * @param o Map to move, left empty
+         * @return A reference to itself
+         */
+        FlatHashMap &operator=(FlatHashMap &&o) noexcept
+        {
+            if(this != &o)
+            {
+                this->Release();
+                this->m_Ctrl = o.m_Ctrl;
+                this->m_Slots = o.m_Slots;
+                this->m_Size = o.m_Size;
+                this->m_Capacity = o.m_Capacity;
+                this->m_Growth = o.m_Growth;
+                this->m_Hash = std::move(o.m_Hash);
+                this->m_Equal = std::move(o.m_Equal);
+                this->m_Alloc = std::move(o.m_Alloc);
+                o.Forget();
+            }
+            return *this;
+        }
+
+        /**
+         * Returns the value of a key, inserting a default one if missing
+         * @param key Key to look for
+         * @return Reference to the value
+         */
+        inline _Tp &operator[](const _Key &key)
+        {
+            return this->try_emplace(key).first->second;
+        }
+
+        /**
+         * Returns the value of a key, inserting a default one if missing
+         * @param key Key to look for, moved into the map if missing
+         * @return Reference to the value
+         */
+        inline _Tp &operator[](_Key &&key)
+        {
+            return this->try_emplace(std::move(key)).first->second;
+        }
+
+        /**
+         * Equalty comparison operator
+         * @param o Map to compare with
+         * @return Whether or not both maps hold the same items
+         */
+        bool operator==(const FlatHashMap &o) const
+        {
+            if(this->m_Size != o.m_Size)
+            {
+                return false;
+            }
+
+            for(const_iterator it = this->begin(); it != this->end(); ++it)
+            {
+                const_iterator other = o.find(it->first);
+                if(other == o.end() || !(other->second == it->second))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /**
+         * Non equalty comparison operator
+         * @param o Map to compare with
+         * @return Whether or not the maps hold different items
+         */
+        inline bool operator!=(const FlatHashMap &o) const
+        {
+            return !(*this == o);
+        }
+
+
+        /// Class implementations
+
+        inline iterator begin()
+        {
+            iterator it(this->m_Ctrl, this->m_Slots);
+            it.SkipEmpty();
+            return it;
+        }
+
+        inline const_iterator begin() const
+        {
+            const_iterator it(this->m_Ctrl, this->m_Slots);
+            it.SkipEmpty();
+            return it;
+        }
+
+        inline const_iterator cbegin() const
+        {
+            return this->begin();
+        }
+
+        inline iterator end()
+        {
+            return iterator(this->m_Ctrl + this->m_Capacity,
+                            this->m_Slots + this->m_Capacity);
+        }
+
+        inline const_iterator end() const
+        {
+            return const_iterator(this->m_Ctrl + this->m_Capacity,
+                                  this->m_Slots + this->m_Capacity);
+        }
+
+        inline const_iterator cend() const
+        {
+            return this->end();
+        }
+
+        inline bool empty() const
+        {
+            return this->m_Size == 0;
+        }
+
+        inline size_t size() const
+        {
+            return this->m_Size;
+        }
+
+        /**
+         * Returns the number of slots
+         * @return Number of slots
+         */
+        inline size_t capacity() const
+        {
+            return this->m_Capacity;
+        }
+
+        inline hasher hash_function() const
+        {
+            return this->m_Hash;
+        }
+
+        inline key_equal key_eq() const
+        {
+            return this->m_Equal;
+        }
+
+        inline allocator_type get_allocator() const
+        {
+            return this->m_Alloc;
+        }
+
+        /**
+         * Finds a key
+         * @param key Key to look for
+         * @return Iterator to the item, or end if there is none
+         */
+        inline iterator find(const _Key &key)
+        {
+            return this->IteratorAt(this->Find(key, this->HashOf(key)));
+        }
+
+        /**
+         * Finds a key
+         * @param key Key to look for
+         * @return Iterator to the item, or end if there is none
+         */
+        inline const_iterator find(const _Key &key) const
+        {
+            return this->IteratorAt(this->Find(key, this->HashOf(key)));
+        }
+
+        /**
+         * Returns whether or not a key is in the map
+         * @param key Key to look for
+         * @return Whether or not the key is in the map
+         */
+        inline bool contains(const _Key &key) const
+        {
+            return this->Find(key, this->HashOf(key)) != this->m_Capacity;
+        }
+
+        /**
+         * Returns the number of items with a key
+         * @param key Key to look for
+         * @return One if the key is in the map, zero otherwise
+         */
+        inline size_t count(const _Key &key) const
+        {
+            return this->contains(key) ? 1 : 0;
+        }
+
+        /**
+         * Returns the value of a key
+         * @param key Key to look for
+         * @return Reference to the value
+         * @throw std::out_of_range If the key is not in the map
+         */
+        inline _Tp &at(const _Key &key)
+        {
+            return this->ValueAt(this->Find(key, this->HashOf(key)));
+        }
+
+        /**
+         * Returns the value of a key
+         * @param key Key to look for
+         * @return Const reference to the value
+         * @throw std::out_of_range If the key is not in the map
+         */
+        inline const _Tp &at(const _Key &key) const
+        {
+            return this->ValueAt(this->Find(key, this->HashOf(key)));
+        }
+
+        /**
+         * Heterogeneous lookup, see the key type overloads
+         * @param key Key to look for, of any type the hash function and the
+         * key comparator accept
+         * @note Only available with transparent hash functions and key
+         * comparators, the key is never converted to the key type
+         */
+        template<typename _K, typename _H = _Hash, typename = typename
+            std::enable_if<FlatHash::IsTransparent<_H, _Pred>::value>::type>
+        inline iterator find(const _K &key)
+        {
+            return this->IteratorAt(this->Find(key, this->HashOf(key)));
+        }
+
+        template<typename _K, typename _H = _Hash, typename = typename
+            std::enable_if<FlatHash::IsTransparent<_H, _Pred>::value>::type>
+        inline const_iterator find(const _K &key) const
+        {
+            return this->IteratorAt(this->Find(key, this->HashOf(key)));
+        }
+
+        template<typename _K, typename _H = _Hash, typename = typename
+            std::enable_if<FlatHash::IsTransparent<_H, _Pred>::value>::type>
+        inline bool contains(const _K &key) const
+        {
+            return this->Find(key, this->HashOf(key)) != this->m_Capacity;
+        }
+
+        template<typename _K, typename _H = _Hash, typename = typename
+            std::enable_if<FlatHash::IsTransparent<_H, _Pred>::value>::type>
+        inline size_t count(const _K &key) const
+        {
+            return this->contains(key) ? 1 : 0;
+        }
+
+        template<typename _K, typename _H = _Hash, typename = typename
+            std::enable_if<FlatHash::IsTransparent<_H, _Pred>::value>::type>
+        inline _Tp &at(const _K &key)
+        {
+            return this->ValueAt(this->Find(key, this->HashOf(key)));
+        }
+
+        template<typename _K, typename _H = _Hash, typename = typename
+            std::enable_if<FlatHash::IsTransparent<_H, _Pred>::value>::type>
+        inline const _Tp &at(const _K &key) const
+        {
+            return this->ValueAt(this->Find(key, this->HashOf(key)));
+        }
+
+        /**
+         * Inserts an item if its key is missing
+         * @param item Item to insert
+         * @return Iterator to the item with the key, and whether or not the
+         * item was inserted
+         */
+        inline std::pair<iterator, bool> insert(const value_type &item)
+        {
+            return this->try_emplace(item.first, item.second);
+        }
+
+        /**
+         * Inserts an item if its key is missing
+         * @param item Item to insert
+         * @return Iterator to the item with the key, and whether or not the
+         * item was inserted
+         */
+        inline std::pair<iterator, bool> insert(value_type &&item)
+        {
+            return this->try_emplace(item.first, std::move(item.second));
+        }
+
+        /**
+         * Builds an item and inserts it if its key is missing
+         * @param args Item constructor arguments
+         * @return Iterator to the item with the key, and whether or not the
+         * item was inserted
+         */
+        template<typename... Args>
+        inline std::pair<iterator, bool> emplace(Args&&... args)
+        {
+            return this->insert(value_type(std::forward<Args>(args)...));
+        }
+
+        /**
+         * Inserts a key with a value built in place if the key is missing
+         * @param key Key to insert
+         * @param args Value constructor arguments
+         * @return Iterator to the item with the key, and whether or not the
+         * item was inserted
+         */
+        template<typename _K, typename... Args>
+        std::pair<iterator, bool> try_emplace(_K &&key, Args&&... args)
+        {
+            size_t hash = this->HashOf(key);
+            size_t index = this->Find(key, hash);
+
+            if(index != this->m_Capacity)
+            {
+                return std::make_pair(this->IteratorAt(index), false);
+            }
+
+            index = this->FindInsertSlot(hash);
+
+            if(index == this->m_Capacity)
+            {
+                // The arguments may live in the table, build the item before
+                // growing it
+                std::pair<_Key, _Tp> item(std::piecewise_construct,
+                    std::forward_as_tuple(std::forward<_K>(key)),
+                    std::forward_as_tuple(std::forward<Args>(args)...));
+
+                this->Grow();
+                index = this->EmplaceAt(this->FindNonFull(hash), hash,
+                    std::move(item.first), std::move(item.second));
+            }
+            else
+            {
+                index = this->EmplaceAt(index, hash, std::forward<_K>(key),
+                                        std::forward<Args>(args)...);
+            }
+
+            return std::make_pair(this->IteratorAt(index), true);
+        }
+
+        /**
+         * Removes an item
+         * @param position Iterator to the item
+         * @return Iterator to the next item
+         */
+        iterator erase(const_iterator position)
+        {
+            size_t index = static_cast<size_t>(position.m_Slot - this->m_Slots);
+            this->EraseAt(index);
+
+            iterator next(this->m_Ctrl + index, this->m_Slots + index);
+            next.SkipEmpty();
+            return next;
+        }
+
+        /**
+         * Removes an item
+         * @param position Iterator to the item
+         * @return Iterator to the next item
+         */
+        inline iterator erase(iterator position)
+        {
+            return this->erase(const_iterator(position));
+        }
+
+        /**
+         * Removes a key
+         * @param key Key to remove
+         * @return Number of removed items
+         */
+        size_t erase(const _Key &key)
+        {
+            size_t index = this->Find(key, this->HashOf(key));
+            if(index == this->m_Capacity)
+            {
+                return 0;
+            }
+
+            this->EraseAt(index);
+            return 1;
+        }
+
+        /**
+         * Removes every item, keeping the slots
+         */
+        void clear()
+        {
+            for(size_t i = 0; i < this->m_Capacity; ++i)
+            {
+                if(this->m_Ctrl[i] >= 0)
+                {
+                    this->m_Slots[i].Value.~value_type();
+                }
+            }
+
+            if(this->m_Capacity)
+            {
+                this->ResetCtrl();
+            }
+
+            this->m_Size = 0;
+            this->m_Growth = FlatHash::CapacityToGrowth(this->m_Capacity);
+        }
+
+        /**
+         * Reserves room for a number of items
+         * @param size Number of items
+         */
+        void reserve(size_t size)
+        {
+            if(size > this->m_Size + this->m_Growth)
+            {
+                this->Resize(FlatHash::GrowthToCapacity(size));
+            }
+        }
+
+        /**
+         * Swaps the contents of two maps
+         * @param o Map to swap with
+         */
+        void swap(FlatHashMap &o) noexcept
+        {
+            std::swap(this->m_Ctrl, o.m_Ctrl);
+            std::swap(this->m_Slots, o.m_Slots);
+            std::swap(this->m_Size, o.m_Size);
+            std::swap(this->m_Capacity, o.m_Capacity);
+            std::swap(this->m_Growth, o.m_Growth);
+            std::swap(this->m_Hash, o.m_Hash);
+            std::swap(this->m_Equal, o.m_Equal);
+            std::swap(this->m_Alloc, o.m_Alloc);
+        }
+
+    private:
+        /// Class helpers
+
+        /**
+         * Returns the mixed hash of a key
+         * @param key Key to hash
+         * @return Mixed hash
+         */
+        template<typename _K>
+        inline size_t HashOf(const _K &key) const
+        {
+            return FlatHash::Mix(this->m_Hash(key));
+        }
+
+        /**
+         * Finds a key
+         * @param key Key to look for
+         * @param hash Mixed hash of the key
+         * @return Slot index, or the capacity if there is none
+         */
+        template<typename _K>
+        size_t Find(const _K &key, size_t hash) const
+        {
+            size_t mask = this->m_Capacity;
+            size_t offset = FlatHash::H1(hash) & mask;
+            FlatHash::Control h2 = FlatHash::H2(hash);
+
+            for(size_t step = 0; ; )
+            {
+                FlatHash::Group group(this->m_Ctrl + offset);
+
+                for(FlatHash::BitMask match = group.Match(h2); match;
+                    match.Next())
+                {
+                    size_t index = (offset + match.Lowest()) & mask;
+                    const Slot &slot = this->m_Slots[index];
+
+                    if(slot.Hash == hash && this->m_Equal(slot.Value.first, key))
+                    {
+                        return index;
+                    }
+                }
+
+                if(group.MatchEmpty())
+                {
+                    return this->m_Capacity;
+                }
+
+                step += FlatHash::GroupWidth;
+                offset = (offset + step) & mask;
+            }
+        }
+
+        /**
+         * Finds the first empty or erased slot of the probe sequence
+         * @param hash Mixed hash
+         * @return Slot index
+         */
+        size_t FindNonFull(size_t hash) const
+        {
+            size_t mask = this->m_Capacity;
+            size_t offset = FlatHash::H1(hash) & mask;
+
+            for(size_t step = 0; ; )
+            {
+                FlatHash::Group group(this->m_Ctrl + offset);
+
+                for(FlatHash::BitMask match = group.MatchEmptyOrDeleted();
+                    match; match.Next())
+                {
+                    size_t index = (offset + match.Lowest()) & mask;
+                    if(this->m_Ctrl[index] < FlatHash::Sentinel)
+                    {
+                        return index;
+                    }
+                }
+
+                step += FlatHash::GroupWidth;
+                offset = (offset + step) & mask;
+            }
+        }
+
+        /**
+         * Finds a slot for a new key
+         * @param hash Mixed hash of the key
+         * @return Slot index, or the capacity if the table must grow first
+         */
+        size_t FindInsertSlot(size_t hash) const
+        {
+            if(this->m_Capacity == 0)
+            {
+                return 0;
+            }
+
+            size_t index = this->FindNonFull(hash);
+
+            if(this->m_Growth == 0 && this->m_Ctrl[index] != FlatHash::Deleted)
+            {
+                return this->m_Capacity;
+            }
+
+            return index;
+        }
+
+        /**
+         * Grows the table, or just drops the erased slots if most of them
+         * are erased
+         */
+        void Grow()
+        {
+            size_t capacity = this->m_Capacity;
+
+            if(capacity == 0)
+            {
+                capacity = FlatHash::MinCapacity;
+            }
+            else if(this->m_Size * 32 >
+                    FlatHash::CapacityToGrowth(capacity) * 25)
+            {
+                capacity = capacity * 2 + 1;
+            }
+
+            this->Resize(capacity);
+        }
+
+        /**
+         * Builds an item in an empty or erased slot
+         * @param index Slot index
+         * @param hash Mixed hash of the key
+         * @param key Item key
+         * @param args Value constructor arguments
+         * @return Slot index
+         */
+        template<typename _K, typename... Args>
+        size_t EmplaceAt(size_t index, size_t hash, _K &&key, Args&&... args)
+        {
+            Slot *slot = this->m_Slots + index;
+
+            new (&slot->Value) value_type(std::piecewise_construct,
+                std::forward_as_tuple(std::forward<_K>(key)),
+                std::forward_as_tuple(std::forward<Args>(args)...));
+            slot->Hash = hash;
+
+            if(this->m_Ctrl[index] == FlatHash::Empty)
+            {
+                --this->m_Growth;
+            }
+
+            this->SetCtrl(index, FlatHash::H2(hash));
+            ++this->m_Size;
+
+            return index;
+        }
+
+        /**
+         * Destroys the item of a slot
+         * @param index Slot index
+         */
+        void EraseAt(size_t index)
+        {
+            this->m_Slots[index].Value.~value_type();
+            this->SetCtrl(index, FlatHash::Deleted);
+            --this->m_Size;
+        }
+
+        /**
+         * Sets the control byte of a slot and its clone
+         * @param index Slot index
+         * @param ctrl Control byte
+         */
+        inline void SetCtrl(size_t index, FlatHash::Control ctrl)
+        {
+            size_t mask = this->m_Capacity;
+            const size_t clones = FlatHash::GroupWidth - 1;
+
+            this->m_Ctrl[index] = ctrl;
+            this->m_Ctrl[((index - clones) & mask) + (clones & mask)] = ctrl;
+        }
+
+        /**
+         * Marks every slot as empty
+         */
+        void ResetCtrl()
+        {
+            std::fill(this->m_Ctrl, this->m_Ctrl + this->m_Capacity +
+                      FlatHash::GroupWidth, FlatHash::Empty);
+            this->m_Ctrl[this->m_Capacity] = FlatHash::Sentinel;
+        }
+
+        /**
+         * Moves every item to a new table
+         * @param capacity Number of slots, a power of two minus one
+         */
+        void Resize(size_t capacity)
+        {
+            FlatHash::Control *ctrl = this->m_Ctrl;
+            Slot *slots = this->m_Slots;
+            size_t previous = this->m_Capacity;
+
+            ControlAllocator ctrlAlloc(this->m_Alloc);
+            SlotAllocator slotAlloc(this->m_Alloc);
+
+            this->m_Slots = std::allocator_traits<SlotAllocator>::allocate(
+                slotAlloc, capacity);
+            this->m_Ctrl = std::allocator_traits<ControlAllocator>::allocate(
+                ctrlAlloc, capacity + FlatHash::GroupWidth);
+            this->m_Capacity = capacity;
+            this->ResetCtrl();
+            this->m_Growth = FlatHash::CapacityToGrowth(capacity) - this->m_Size;
+
+            for(size_t i = 0; i < previous; ++i)
+            {
+                if(ctrl[i] >= 0)
+                {
+                    this->Transfer(slots[i]);
+                }
+            }
+
+            this->Free(ctrl, slots, previous);
+        }
+
+        /**
+         * Moves an item of the previous table to the current one
+         * @param source Slot of the previous table, left destroyed
+         */
+        void Transfer(Slot &source)
+        {
+            size_t index = this->FindNonFull(source.Hash);
+            Slot *slot = this->m_Slots + index;
+
+            // The source key is destroyed right after, so it can be moved
+            // even if it is const
+            new (&slot->Value) value_type(
+                std::move(const_cast<_Key &>(source.Value.first)),
+                std::move(source.Value.second));
+            slot->Hash = source.Hash;
+            source.Value.~value_type();
+
+            this->SetCtrl(index, FlatHash::H2(source.Hash));
+        }
+
+        /**
+         * Returns an iterator to a slot
+         * @param index Slot index, or the capacity
+         * @return Iterator to the slot
+         */
+        inline iterator IteratorAt(size_t index)
+        {
+            return iterator(this->m_Ctrl + index, this->m_Slots + index);
+        }
+
+        inline const_iterator IteratorAt(size_t index) const
+        {
+            return const_iterator(this->m_Ctrl + index, this->m_Slots + index);
+        }
+
+        /**
+         * Returns the value of a slot
+         * @param index Slot index, or the capacity
+         * @return Reference to the value
+         * @throw std::out_of_range If the index is the capacity
+         */
+        inline _Tp &ValueAt(size_t index) const
+        {
+            if(index == this->m_Capacity)
+            {
+                throw std::out_of_range("FlatHashMap::at");
+            }
+
+            return this->m_Slots[index].Value.second;
+        }
+
+        /**
+         * Destroys every item and frees the table
+         */
+        void Release()
+        {
+            for(size_t i = 0; i < this->m_Capacity; ++i)
+            {
+                if(this->m_Ctrl[i] >= 0)
+                {
+                    this->m_Slots[i].Value.~value_type();
+                }
+            }
+
+            this->Free(this->m_Ctrl, this->m_Slots, this->m_Capacity);
+            this->Forget();
+        }
+
+        /**
+         * Frees a table
+         * @param ctrl Control bytes
+         * @param slots Slots
+         * @param capacity Number of slots
+         */
+        void Free(FlatHash::Control *ctrl, Slot *slots, size_t capacity)
+        {
+            if(capacity)
+            {
+                ControlAllocator ctrlAlloc(this->m_Alloc);
+                SlotAllocator slotAlloc(this->m_Alloc);
+
+                std::allocator_traits<ControlAllocator>::deallocate(
+                    ctrlAlloc, ctrl, capacity + FlatHash::GroupWidth);
+                std::allocator_traits<SlotAllocator>::deallocate(
+                    slotAlloc, slots, capacity);
+            }
+        }
+
+        /**
+         * Leaves the map empty without freeing its table
+         */
+        inline void Forget()
+        {
+            this->m_Ctrl = FlatHash::EmptyGroup();
+            this->m_Slots = nullptr;
+            this->m_Size = 0;
+            this->m_Capacity = 0;
+            this->m_Growth = 0;
+        }
+
+        /// Class attributes
+
+        /**
+         * Control bytes, followed by a sentinel and clones of the first ones
+         */
+        FlatHash::Control *m_Ctrl;
+
+        /**
+         * Slots
+         */
+        Slot *m_Slots;
+
+        /**
+         * Number of items
+         */
+        size_t m_Size;
+
+        /**
+         * Number of slots, a power of two minus one, doubles as probe mask
+         */
+        size_t m_Capacity;
+
+        /**
+         * Number of items that can be inserted before the table grows
+         */
+        size_t m_Growth;
+
+        /**
+         * Hash function
+         */
+        _Hash m_Hash;
+
+        /**
+         * Key equality function
+         */
+        _Pred m_Equal;
+
+        /**
+         * Allocator
+         */
+        _Alloc m_Alloc;
+    };
+}
+
+#endif /* DYNOBJECTS_FLAT_HASH_MAP_H */
@@ -34,19 +34,62 @@
 /// External libs includes
 
 // C++11 standard
+#include <atomic>
+#include <memory>
 #include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
 
 /**
  * DynObjects library namespace
  */
 namespace DynObjects
 {
+    /**
+     * Frozen object construction tag
+     */
+    struct FrozenTag
+    {
+    };
+
+    /**
+     * Frozen object construction tag value
+     */
+    const FrozenTag Frozen = FrozenTag();
+
+    template<typename _CharT, typename _Traits>
+    class ImmutableString;
+
+    /**
+     * Immutable peer trait
+     * @note Specialized for the payload types with an immutable counterpart:
+     * type is the dynamic type holding the same values, objects of both
+     * types with the same value are equal
+     */
+    template<typename T>
+    struct ImmutablePeer
+    {
+    };
+
+    template<typename _CharT, typename _Traits>
+    struct ImmutablePeer<std::basic_string<_CharT, _Traits,
+                                           std::allocator<_CharT>>>
+    {
+        typedef ImmutableString<_CharT, _Traits> type;
+    };
+
     /**
      * Generic object class
+     * @note Frozen objects (see Freeze) are immutable and compute their
+     * hash once. The encapsulated object is a private base, reached through
+     * de-reference only. The object interface goes first, so converting
+     * from and to it never adjusts the pointer
      */
     template<typename T>
-    class Generic : public T, public virtual Object
-    {       
+    class Generic final : public StaticObject<Generic<T>>, private T
+    {
     public:
         /// Class constructors
 
@@ -54,8 +97,50 @@ namespace DynObjects
          * Class constructor
          * @param args Variable arguments for encapsulated object
          */
+        template<typename... Args, typename = typename std::enable_if<
+            !IsSingleOf<Generic, Args...>::value>::type>
+        inline Generic(Args&&... args) :
+        StaticObject<Generic>(GetTypeId<Generic>()),
+        T(std::forward<Args>(args)...),
+        m_HashState(Mutable)
+        {
+        }
+
+        /**
+         * Frozen object constructor
+         * @param args Variable arguments for encapsulated object
+         */
         template<typename... Args>
-        inline Generic(Args... args) : T(args...)
+        inline Generic(FrozenTag, Args&&... args) :
+        StaticObject<Generic>(GetTypeId<Generic>()),
+        T(std::forward<Args>(args)...),
+        m_HashState(FrozenUnhashed)
+        {
+        }
+
+        /**
+         * Class copy constructor
+         * @param o Object to copy
+         * @note Copies of a frozen object are frozen
+         */
+        inline Generic(const Generic &o) :
+        StaticObject<Generic>(o), T(o),
+        m_HashState(o.m_HashState.load(std::memory_order_relaxed))
+        {
+        }
+
+        /**
+         * Class move constructor
+         * @param o Object to move
+         * @note Frozen objects are copied instead, they keep their value
+         * and hash as keys of a container may still refer to them
+         */
+        inline Generic(Generic &&o)
+            noexcept(std::is_nothrow_move_constructible<T>::value &&
+                     std::is_nothrow_copy_constructible<T>::value) :
+        StaticObject<Generic>(o),
+        T(Generic::Take(o, std::is_copy_constructible<T>())),
+        m_HashState(o.m_HashState.load(std::memory_order_relaxed))
         {
         }
 
@@ -69,13 +154,42 @@ namespace DynObjects
 
         /// Class operators
 
+        /**
+         * Copy assignation operator
+         * @param o Object to be assigned
+         * @return A reference to itself
+         */
+        inline Generic &operator=(const Generic &o)
+        {
+            this->CheckMutable();
+            T::operator=(o);
+            Object::operator=(o);
+            return *this;
+        }
+
+        /**
+         * Move assignation operator
+         * @param o Object to be moved
+         * @return A reference to itself
+         */
+        inline Generic &operator=(Generic &&o)
+        {
+            this->CheckMutable();
+            T::operator=(Generic::Take(o, std::is_copy_constructible<T>()));
+            Object::operator=(o);
+            return *this;
+        }
+
         /**
          * De-reference operator
          * @return A reference to the encapsulated object
+         * @throw std::logic_error If the object is frozen, read frozen
+         * objects through the const overload or GetValue
          */
         inline T &operator*()
         {
-          return dynamic_cast<T&>(*this);
+            this->CheckMutable();
+            return static_cast<T &>(*this);
         }
 
         /**
@@ -84,113 +198,239 @@ namespace DynObjects
          */
         inline const T &operator*() const
         {
-          return dynamic_cast<const T&>(*this);
+            return static_cast<const T &>(*this);
         }
 
         /**
-         * Non equalty comparison operator
-         * @param o Object to compare
-         * @return Result of the comparison
+         * Comparison operators of the object interface, the ones of the
+         * encapsulated object are reached through de-reference
+         */
+        using Object::operator!=;
+        using Object::operator==;
+        using Object::operator<;
+        using Object::operator>;
+        using Object::operator<=;
+        using Object::operator>=;
+
+
+        /// Class implementation
+
+        /**
+         * Object interface methods, the ones of the encapsulated object are
+         * reached through de-reference
+         */
+        using StaticObject<Generic>::compare;
+        using StaticObject<Generic>::hash;
+
+        /**
+         * Returns object type
+         * @return Object type
          */
-        virtual bool operator!=(const Object &o) const
+        virtual std::string GetObjectType() const
         {
-            try
-            {
-                return Operators::NotEquals<T>::Compare(
-                dynamic_cast<const T&>(*this), dynamic_cast<const T&>(o));
-            }
-            catch(std::bad_cast &)
-            {
-                return true;
-            }
+          return GetTypeInfo<Generic>().GetName();
         }
 
         /**
-         * Equalty comparison operator
-         * @param o Object to compare
-         * @return Result of the comparison
+         * Three-way comparison of two generic objects, see StaticObject
+         * @param a Object A
+         * @param b Object B
+         * @return Ordering of a relative to b
+         */
+        static inline Ordering Compare(const Generic &a, const Generic &b)
+        {
+            return Operators::ThreeWay<T>::Compare(*a, *b);
+        }
+
+        /**
+         * Total order of two generic objects, see StaticObject
+         * @param a Object A
+         * @param b Object B
+         * @return Ordering of a relative to b, never unordered
+         */
+        static inline Ordering TotalOrder(const Generic &a, const Generic &b)
+        {
+            return Operators::TotalOrder<T>::Compare(*a, *b);
+        }
+
+        /**
+         * Orders an object of another type, by value if it is of the
+         * immutable peer type (see ImmutablePeer)
+         * @param o Object of another type
+         * @return Ordering of the object relative to o
          */
-        virtual bool operator==(const Object &o) const
+        inline Ordering CompareOther(const Object &o) const
         {
-            try
+            return this->ComparePeer(o, 0);
+        }
+
+        /**
+         * Hashing method, see StaticObject
+         * @return Hash of the object, cached once frozen
+         */
+        inline size_t Hash() const
+        {
+            size_t state = this->m_HashState.load(std::memory_order_relaxed);
+            if(state > FrozenUnhashed)
             {
-                return Operators::Equals<T>::Compare(
-                dynamic_cast<const T&>(*this), dynamic_cast<const T&>(o));
+                return state;
             }
-            catch(std::bad_cast &)
+
+            size_t hash = Operators::Hash<T>()(this->operator*());
+
+            if(state == FrozenUnhashed && hash > FrozenUnhashed)
             {
-                return false;
+                this->m_HashState.store(hash, std::memory_order_relaxed);
             }
+
+            return hash;
         }
 
         /**
-         * Less than comparison operator
-         * @param o Object to compare
-         * @return Result of the comparison
+         * Returns the encapsulated object for reading
+         * @return A const reference to the encapsulated object
+         * @note Never fails, even on frozen objects
          */
-        virtual bool operator<(const Object &o) const
+        inline const T &GetValue() const
         {
-            return Operators::Less<T>::Compare(
-            dynamic_cast<const T&>(*this), dynamic_cast<const T&>(o));
+            return static_cast<const T &>(*this);
         }
 
         /**
-         * Greater than comparison operator
-         * @param o Object to compare
-         * @return Result of the comparison
+         * Freezes the object, it can not be modified afterwards
+         * @note Freeze objects before sharing them with other threads
          */
-        virtual bool operator>(const Object &o) const
+        inline void Freeze()
         {
-            return Operators::Greater<T>::Compare(
-            dynamic_cast<const T&>(*this), dynamic_cast<const T&>(o));
+            size_t state = Mutable;
+            this->m_HashState.compare_exchange_strong(state, FrozenUnhashed,
+                std::memory_order_relaxed);
         }
 
         /**
-         * Less or equal than comparison operator
-         * @param o Object to compare
-         * @return Result of the comparison
+         * Returns whether or not the object is frozen
+         * @return Whether or not the object is frozen
          */
-        virtual bool operator<=(const Object &o) const
+        inline bool IsFrozen() const
         {
-            return Operators::LessEquals<T>::Compare(
-            dynamic_cast<const T&>(*this), dynamic_cast<const T&>(o));
+            return this->m_HashState.load(std::memory_order_relaxed) !=
+                Mutable;
         }
 
         /**
-         * Greater or equal than comparison operator
-         * @param o Object to compare
-         * @return Result of the comparison
+         * Visits the object pointers held by the encapsulated object
+         * @param visitor Function called with each held pointer
+         * @param context Opaque context passed to the visitor
          */
-        virtual bool operator>=(const Object &o) const
+        virtual void ForEachChild(Operators::ObjectVisitor visitor,
+                                  void *context) const
         {
-            return Operators::GreaterEquals<T>::Compare(
-            dynamic_cast<const T&>(*this), dynamic_cast<const T&>(o));
+            Operators::ForEachObject<T>::Visit(this->operator*(), visitor,
+                                               context);
         }
 
+    private:
+        /// Class helpers
 
-        /// Class implementation
+        /**
+         * Hash states, any other state is the hash of a frozen object
+         * @note Frozen objects whose hash is one of these states do not
+         * cache it
+         */
+        enum : size_t
+        {
+            Mutable = 0,
+            FrozenUnhashed = 1
+        };
 
         /**
-         * Returns object type
-         * @return Object type
+         * Takes the value of an object being moved
+         * @param o Object being moved
+         * @return A copy of the value if o is frozen, the value otherwise
          */
-        virtual std::string GetObjectType() const
+        static inline T Take(Generic &o, std::true_type)
         {
-          return DemangleObjectName(typeid(T).name());
+            if(o.IsFrozen())
+            {
+                return static_cast<const T &>(o);
+            }
+
+            return static_cast<T &&>(o);
         }
 
         /**
-         * Hashing method
-         * @return Hash of the object
+         * Takes the value of an object being moved
+         * @param o Object being moved
+         * @return The value
+         * @throw std::logic_error If o is frozen, its value can not be copied
          */
-        virtual size_t hash() const
+        static inline T &&Take(Generic &o, std::false_type)
         {
-            return Operators::Hash<T>()(this->operator*());
+            o.CheckMutable();
+            return static_cast<T &&>(o);
         }
+
+        /**
+         * Fails if the object is frozen
+         * @throw std::logic_error If the object is frozen
+         */
+        inline void CheckMutable() const
+        {
+            if(this->IsFrozen())
+            {
+                throw std::logic_error("Frozen objects can not be modified");
+            }
+        }
+
+        /**
+         * Orders an object of another type
+         * @param o Object to compare
+         * @return Ordering of the object relative to o
+         */
+        template<typename U = T,
+                 typename _Peer = typename ImmutablePeer<U>::type>
+        inline Ordering ComparePeer(const Object &o, int) const
+        {
+            if(o.GetObjectTypeId() != GetTypeId<_Peer>())
+            {
+                return this->CompareTypeId(o);
+            }
+
+            const _Peer &peer = static_cast<const _Peer &>(o);
+            const T &value = this->operator*();
+
+            return Operators::Impl::ToOrdering(_Peer::Compare(value.data(),
+                value.size(), peer.data(), peer.size()));
+        }
+
+        inline Ordering ComparePeer(const Object &o, long) const
+        {
+            return this->CompareTypeId(o);
+        }
+
+        /// Class attributes
+
+        /**
+         * Hash state, the cached hash once frozen and hashed
+         */
+        mutable std::atomic<size_t> m_HashState;
+    };
+
+    /**
+     * Generic objects value type
+     */
+    template<typename T>
+    struct ValueTypeOf<Generic<T>>
+    {
+        typedef T type;
     };
 
     template<typename T>
     using GenericInstance = Instance<T, Generic<T>>;
 }
+
+// Immutable peers of the generic objects, they compare with each other
+#include "ImmutableString.h"
+
 #endif /* DYNOBJECTS_GENERIC_H */
 
@@ -0,0 +1,501 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   ImmutableString.h
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 22:15
+ */
+
+#ifndef DYNOBJECTS_IMMUTABLE_STRING_H
+#define DYNOBJECTS_IMMUTABLE_STRING_H
+
+/// Internal libs includes
+#include "Allocator.h"
+#include "Generic.h"
+#include "Instance.h"
+#include "Object.h"
+#include "Operators.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+
+
+/**
+ * DynObjects library namespace
+ */
+namespace DynObjects
+{
+    /**
+     * Immutable string object
+     * @note The characters live in the same block as the object, so a
+     * string is a single allocation sized to its content. Without
+     * intrusive reference counting the block also holds the std::shared_ptr
+     * control block, the characters follow it
+     * The hash is computed once. Strings compare equal to and hash as the
+     * String objects holding the same characters
+     */
+    template<typename _CharT, typename _Traits = std::char_traits<_CharT>>
+    class ImmutableString : public Object
+    {
+        /**
+         * Construction tag, only Create builds strings
+         */
+        struct ConstructTag
+        {
+        };
+
+        /**
+         * Trailing storage size, for the allocation functions
+         */
+        struct Trailing
+        {
+            size_t Size;
+        };
+
+    public:
+        /// Types definitions
+
+        typedef _CharT value_type;
+        typedef _Traits traits_type;
+        typedef std::basic_string<_CharT, _Traits> string_type;
+        typedef const _CharT *const_iterator;
+
+        /// Class constructors
+
+        /**
+         * Class constructor, see Create
+         * @param tag Construction tag
+         * @param data Characters, copied after the object
+         * @param size Number of characters
+         * @param trailing Where the start of the storage of the characters
+         * was recorded, right after the object if null
+         */
+        ImmutableString(ConstructTag, const _CharT *data, size_t size,
+                        void *const *trailing = nullptr) :
+        Object(GetTypeId<ImmutableString>()),
+        m_Size(static_cast<uint32_t>(size)),
+        m_Offset(trailing ? static_cast<uint32_t>(
+            static_cast<const char *>(*trailing) -
+            reinterpret_cast<const char *>(this)) :
+            static_cast<uint32_t>(sizeof(ImmutableString))),
+        m_Hash(0)
+        {
+            _CharT *chars = const_cast<_CharT *>(this->data());
+            _Traits::copy(chars, data, size);
+            _Traits::assign(chars[size], _CharT());
+        }
+
+        /**
+         * Prevents the use of the copy constructor, strings are shared
+         */
+        ImmutableString(const ImmutableString &) = delete;
+
+        /**
+         * Class destructor
+         */
+        virtual ~ImmutableString()
+        {
+#ifdef DYNOBJECTS_INTRUSIVE_REFCOUNT
+            // Leaves the storage size where operator delete finds it
+            size_t extra = Storage(this->m_Size);
+            std::memcpy(reinterpret_cast<char *>(this + 1), &extra,
+                        sizeof(extra));
+#endif
+        }
+
+        /**
+         * Builds a string
+         * @param data Characters
+         * @param size Number of characters
+         * @return Object pointer to the new string
+         * @throw std::length_error If the string does not fit in 32 bits
+         */
+        static inline ObjectPtr Create(const _CharT *data, size_t size)
+        {
+            if(size > UINT32_MAX)
+            {
+                throw std::length_error("ImmutableString is too long");
+            }
+
+#ifdef DYNOBJECTS_INTRUSIVE_REFCOUNT
+            return ObjectPtr(new (Trailing{Storage(size)})
+                ImmutableString(ConstructTag(), data, size));
+#else
+            // The allocator records where the characters go, wherever the
+            // object lies in the control block
+            void *trailing = nullptr;
+            return ObjectPtr(std::allocate_shared<ImmutableString>(
+                TrailingAllocator<ImmutableString>(Storage(size), &trailing),
+                ConstructTag(), data, size, &trailing));
+#endif
+        }
+
+        static inline ObjectPtr Create()
+        {
+            static const _CharT empty = _CharT();
+            return Create(&empty, 0);
+        }
+
+        static inline ObjectPtr Create(const _CharT *s)
+        {
+            return Create(s, _Traits::length(s));
+        }
+
+        template<typename _Alloc>
+        static inline ObjectPtr Create(
+            const std::basic_string<_CharT, _Traits, _Alloc> &s)
+        {
+            return Create(s.data(), s.size());
+        }
+
+#if __cplusplus >= 201703L
+        static inline ObjectPtr Create(
+            std::basic_string_view<_CharT, _Traits> s)
+        {
+            return Create(s.data(), s.size());
+        }
+#endif
+
+        /// Class allocation
+
+#ifdef DYNOBJECTS_INTRUSIVE_REFCOUNT
+        /**
+         * Allocates a string with room for its characters
+         * @param size Object size
+         * @param extra Trailing storage size
+         * @return Pointer to the object storage
+         */
+        static inline void *operator new(size_t size, Trailing extra)
+        {
+            return Allocator::Allocate(size + extra.Size);
+        }
+
+        /**
+         * Returns the storage of a string that failed to construct
+         */
+        static inline void operator delete(void *ptr, Trailing extra)
+        {
+            Allocator::Deallocate(ptr, sizeof(ImmutableString) + extra.Size);
+        }
+
+        /**
+         * Returns a string storage to the dynamic objects allocator
+         * @param ptr Pointer to the object storage
+         * @param size Object size
+         */
+        static inline void operator delete(void *ptr, size_t size)
+        {
+            size_t extra;
+            std::memcpy(&extra, static_cast<char *>(ptr) + size,
+                        sizeof(extra));
+            Allocator::Deallocate(ptr, size + extra);
+        }
+#endif
+
+        /// Class operators
+
+        /**
+         * De-reference operator
+         * @return A const reference to itself
+         */
+        inline const ImmutableString &operator*() const
+        {
+            return *this;
+        }
+
+        /**
+         * Prevents the use of the copy operator
+         */
+        void operator=(const ImmutableString &) = delete;
+
+        inline const _CharT &operator[](size_t index) const
+        {
+            return this->data()[index];
+        }
+
+#if __cplusplus >= 201703L
+        /**
+         * Casting operator to string view
+         */
+        inline operator std::basic_string_view<_CharT, _Traits>() const
+        {
+            return std::basic_string_view<_CharT, _Traits>(this->data(),
+                                                           this->m_Size);
+        }
+#endif
+
+        using Object::operator!=;
+        using Object::operator==;
+        using Object::operator<;
+        using Object::operator>;
+        using Object::operator<=;
+        using Object::operator>=;
+
+        /// Class implementations
+
+        /**
+         * Three-way comparison method
+         * @param o Object to compare
+         * @return Ordering of the object relative to o
+         * @note Strings are ordered among the other types as String is,
+         * see OrderPeerOf
+         */
+        virtual Ordering compare(const Object &o) const
+        {
+            typedef Generic<string_type> _Peer;
+
+            const _CharT *data;
+            size_t size;
+            TypeId id = o.GetObjectTypeId();
+
+            if(id == this->m_TypeId)
+            {
+                const ImmutableString &s =
+                    static_cast<const ImmutableString &>(o);
+                data = s.data();
+                size = s.size();
+            }
+            else if(id == GetTypeId<_Peer>())
+            {
+                const string_type &s = *static_cast<const _Peer &>(o);
+                data = s.data();
+                size = s.size();
+            }
+            else
+            {
+                return this->CompareTypeId(o);
+            }
+
+            return Operators::Impl::ToOrdering(Compare(this->data(),
+                this->m_Size, data, size));
+        }
+
+        virtual std::string GetObjectType() const
+        {
+            return GetTypeInfo<ImmutableString>().GetName();
+        }
+
+        /**
+         * Hashing method
+         * @return Hash of the object, computed once
+         */
+        virtual size_t hash() const
+        {
+            size_t hash = this->m_Hash.load(std::memory_order_relaxed);
+            if(!hash)
+            {
+                hash = Operators::Hash<string_type>::Hash(this->data(),
+                                                          this->m_Size);
+                this->m_Hash.store(hash, std::memory_order_relaxed);
+            }
+
+            return hash;
+        }
+
+        /**
+         * Returns the characters
+         * @return Pointer to the null-terminated characters
+         */
+        inline const _CharT *data() const
+        {
+            return reinterpret_cast<const _CharT *>(
+                reinterpret_cast<const char *>(this) + this->m_Offset);
+        }
+
+        inline const _CharT *c_str() const
+        {
+            return this->data();
+        }
+
+        /**
+         * Returns the number of characters
+         * @return Number of characters
+         */
+        inline size_t size() const
+        {
+            return this->m_Size;
+        }
+
+        inline size_t length() const
+        {
+            return this->m_Size;
+        }
+
+        inline bool empty() const
+        {
+            return !this->m_Size;
+        }
+
+        inline const_iterator begin() const
+        {
+            return this->data();
+        }
+
+        inline const_iterator end() const
+        {
+            return this->data() + this->m_Size;
+        }
+
+        /**
+         * Returns a copy of the characters
+         * @return Standard string
+         */
+        inline string_type ToString() const
+        {
+            return string_type(this->data(), this->m_Size);
+        }
+
+        /**
+         * Compares the characters with others
+         * @param data Characters
+         * @param size Number of characters
+         * @return Whether or not they are the same characters
+         */
+        inline bool Equals(const _CharT *data, size_t size) const
+        {
+            return size == this->m_Size &&
+                !_Traits::compare(this->data(), data, size);
+        }
+
+        /**
+         * Compares two character sequences as std::basic_string does
+         * @return Negative, zero or positive as a is less, equal or greater
+         * than b
+         */
+        static inline int Compare(const _CharT *a, size_t aSize,
+                                  const _CharT *b, size_t bSize)
+        {
+            int result = _Traits::compare(a, b, aSize < bSize ? aSize : bSize);
+            if(result)
+            {
+                return result;
+            }
+
+            return aSize < bSize ? -1 : (aSize > bSize ? 1 : 0);
+        }
+
+    private:
+        /// Class helpers
+
+        /**
+         * Returns the trailing storage size of a string
+         * @param size Number of characters
+         * @return Storage size, room for the characters and the terminator
+         * @note Intrusive strings leave their storage size in the trailing
+         * storage once destroyed, so it has room for it
+         */
+        static inline size_t Storage(size_t size)
+        {
+            size_t bytes = (size + 1) * sizeof(_CharT);
+#ifdef DYNOBJECTS_INTRUSIVE_REFCOUNT
+            if(bytes < sizeof(size_t))
+            {
+                return sizeof(size_t);
+            }
+#endif
+            return bytes;
+        }
+
+        /// Class attributes
+
+        /**
+         * Number of characters
+         */
+        uint32_t m_Size;
+
+        /**
+         * Offset of the characters from the start of the object
+         */
+        uint32_t m_Offset;
+
+        /**
+         * Hash of the characters, zero until computed
+         */
+        mutable std::atomic<size_t> m_Hash;
+    };
+
+    /**
+     * Immutable strings are ordered among the other types as strings are
+     */
+    template<typename _CharT, typename _Traits>
+    struct OrderPeerOf<ImmutableString<_CharT, _Traits>>
+    {
+        static inline const TypeInfo *GetInfo()
+        {
+            return &GetTypeInfo<Generic<std::basic_string<_CharT, _Traits>>>();
+        }
+    };
+
+    /**
+     * Immutable strings are built by Create, with room for their characters
+     */
+    template<typename _CharT, typename _Traits>
+    struct ObjectFactory<ImmutableString<_CharT, _Traits>> :
+    public std::true_type
+    {
+        template<typename... Args>
+        static inline ObjectPtr Create(Args&&... args)
+        {
+            return ImmutableString<_CharT, _Traits>::Create(
+                std::forward<Args>(args)...);
+        }
+    };
+
+    // Basic immutable string class
+    template<typename _CharT, typename _Traits = std::char_traits<_CharT>>
+    using BasicText = Instance<const ImmutableString<_CharT, _Traits>,
+                               ImmutableString<_CharT, _Traits>>;
+
+    // ASCII immutable string
+    typedef BasicText<char> Text;
+
+    // Unicode immutable string
+    typedef BasicText<wchar_t> WText;
+
+    /**
+     * Stream operator for immutable strings
+     * @param os Output stream
+     * @param item String to write to the stream
+     * @return Modified stream
+     * @note Declared here to be found by argument-dependent lookup
+     */
+    template<typename _CharT, typename _Traits>
+    inline std::basic_ostream<_CharT, _Traits> &operator<<(
+        std::basic_ostream<_CharT, _Traits> &os,
+        const ImmutableString<_CharT, _Traits> &item)
+    {
+        return os.write(item.data(), item.size());
+    }
+}
+
+#endif /* DYNOBJECTS_IMMUTABLE_STRING_H */
+
@@ -28,6 +28,24 @@
 /// Internal libs includes
 #include "Object.h"
 
+/// External libs includes
+
+// C++11 standard
+#include <type_traits>
+#include <utility>
+
+
+/**
+ * Whether or not instances verify the dynamic type on de-reference
+ * @note Enabled by default unless NDEBUG is defined
+ */
+#ifndef DYNOBJECTS_CHECKED_CAST
+#ifdef NDEBUG
+#define DYNOBJECTS_CHECKED_CAST 0
+#else
+#define DYNOBJECTS_CHECKED_CAST 1
+#endif
+#endif
 
 /**
  * DynObjects library namespace
@@ -41,6 +59,11 @@ namespace DynObjects
     class Instance : public ObjectPtr
     {
     public:
+        /// Types definitions
+
+        typedef _Tp value_type;
+        typedef _Type object_type;
+
         ///Class constructors
 
         /**
@@ -52,24 +75,62 @@ namespace DynObjects
         {
         }
 
+        /**
+         * Class constructor with a temporary shared pointer
+         * @param ptr Shared pointer to move
+         */
+        inline Instance(ObjectPtr &&ptr) : ObjectPtr(std::move(ptr))
+        {
+        }
+
+        /**
+         * Class copy constructor
+         * @param o Instance to copy
+         */
+        Instance(const Instance &o) = default;
+
+        /**
+         * Class move constructor
+         * @param o Instance to move
+         */
+        Instance(Instance &&o) = default;
+
         /**
          * Generic class constructor
-         * @param args List of encapsulated object constructor arguments
+         * @param args List of encapsulated object constructor arguments,
+         * forwarded to the encapsulated object
+         * @note A single pointer argument is a cast, not a construction
          */
-        template<typename... Args>
-        inline Instance(Args... args) :
-        ObjectPtr(std::make_shared<_Type>(args...))
+        template<typename... Args, typename = typename std::enable_if<
+            !IsSingleOf<ObjectPtr, Args...>::value>::type>
+        inline Instance(Args&&... args) :
+        ObjectPtr(InPlace<_Type>(), std::forward<Args>(args)...)
         {
         }
 
         /**
          * Class destructor
          */
-        virtual ~Instance()
+        ~Instance()
         {
         }
 
         /// Class operators
+
+        /**
+         * Copy assignation operator
+         * @param o Instance to assign
+         * @return A reference to itself
+         */
+        Instance &operator=(const Instance &o) = default;
+
+        /**
+         * Move assignation operator
+         * @param o Instance to move
+         * @return A reference to itself
+         */
+        Instance &operator=(Instance &&o) = default;
+
         /**
          * Comparison operator with another generic instance
          * @param o Another generic instance
@@ -90,18 +151,98 @@ namespace DynObjects
             return this->operator *() == o;
         }
 
+        /**
+         * Comparison operators with another instance of the same type,
+         * statically dispatched (see StaticObject)
+         * @param o Another instance
+         * @return Result of the comparison
+         * @note Pointers of other types are compared through the object
+         * interface
+         */
+        inline bool operator!=(const Instance &o) const
+        {
+            return this->compare(o) != Ordering::Equal;
+        }
+
+        inline bool operator<(const Instance &o) const
+        {
+            return this->compare(o) == Ordering::Less;
+        }
+
+        inline bool operator>(const Instance &o) const
+        {
+            return this->compare(o) == Ordering::Greater;
+        }
+
+        inline bool operator<=(const Instance &o) const
+        {
+            Ordering result = this->compare(o);
+            return result == Ordering::Less || result == Ordering::Equal;
+        }
+
+        inline bool operator>=(const Instance &o) const
+        {
+            Ordering result = this->compare(o);
+            return result == Ordering::Greater || result == Ordering::Equal;
+        }
+
+        using ObjectPtr::operator!=;
+        using ObjectPtr::operator==;
+        using ObjectPtr::operator<;
+        using ObjectPtr::operator>;
+        using ObjectPtr::operator<=;
+        using ObjectPtr::operator>=;
+
 
         /// Class implementations
 
+        /**
+         * Replaces the object with a new one built in place
+         * @param args List of encapsulated object constructor arguments,
+         * forwarded to the encapsulated object
+         * @return A reference to the new encapsulated object
+         */
+        template<typename... Args>
+        inline _Tp &Emplace(Args&&... args)
+        {
+            ObjectPtr::operator=(
+                ObjectPtr(InPlace<_Type>(), std::forward<Args>(args)...));
+            return this->operator*();
+        }
+
+        /**
+         * Three-way comparison method
+         * @param o Another instance of the same type
+         * @return Ordering of the object relative to the one of o
+         * @note Statically dispatched when the instance type allows it (see
+         * StaticObject)
+         */
+        inline Ordering compare(const Instance &o) const
+        {
+            return StaticDispatch<_Type>::Compare(this->GetObject(),
+                                                  o.GetObject());
+        }
+
+        using ObjectPtr::compare;
+
+        /**
+         * Hashing method
+         * @return Hash of the object
+         * @note Statically dispatched when the instance type allows it (see
+         * StaticObject)
+         */
+        inline size_t hash() const
+        {
+            return StaticDispatch<_Type>::Hash(this->GetObject());
+        }
+
         /**
          * De-reference operator
          * @return A reference to the encapsulated object
          */
         inline _Tp &operator*()
         {
-            return static_cast<_Tp &>(
-            **std::dynamic_pointer_cast<_Type>(
-            static_cast<std::shared_ptr<Object>>(*this)).get());
+            return *this->GetObject();
         }
 
         /**
@@ -110,9 +251,176 @@ namespace DynObjects
          */
         inline  const _Tp &operator*() const
         {
-            return const_cast<_Tp &>(
-            **std::dynamic_pointer_cast<_Type>(
-            static_cast<std::shared_ptr<Object>>(*this)).get());
+            return *this->GetObject();
+        }
+
+        /**
+         * Returns the encapsulated object for reading
+         * @return A const reference to the encapsulated object
+         * @note Never fails on frozen objects (see Generic::Freeze), unlike
+         * the non-const de-reference operator
+         */
+        inline const _Tp &GetValue() const
+        {
+            return *this->GetObject();
+        }
+
+        /**
+         * Returns the dynamic object
+         * @return A reference to the dynamic object
+         * @throw std::bad_cast If DYNOBJECTS_CHECKED_CAST is enabled and the
+         * object is not of the instance type
+         */
+        inline _Type &GetObject()
+        {
+#if DYNOBJECTS_CHECKED_CAST
+            return ObjectCast<_Type>(ObjectPtr::operator*());
+#else
+            return static_cast<_Type &>(ObjectPtr::operator*());
+#endif
+        }
+
+        /**
+         * Returns the dynamic object
+         * @return A const reference to the dynamic object
+         * @throw std::bad_cast If DYNOBJECTS_CHECKED_CAST is enabled and the
+         * object is not of the instance type
+         */
+        inline const _Type &GetObject() const
+        {
+#if DYNOBJECTS_CHECKED_CAST
+            return ObjectCast<_Type>(ObjectPtr::operator*());
+#else
+            return static_cast<const _Type &>(ObjectPtr::operator*());
+#endif
+        }
+    };
+
+    /**
+     * Borrowed instance reference, see ObjectRef
+     * @note Typed view of an object that neither copies the object pointer
+     * nor touches the reference count
+     */
+    template<typename _Tp, typename _Type>
+    class InstanceRef : public ObjectRef
+    {
+    public:
+        /// Types definitions
+
+        typedef _Tp value_type;
+        typedef _Type object_type;
+
+        /// Class constructors
+
+        /**
+         * Class constructor with an instance
+         * @param o Instance, it must outlive the reference
+         */
+        inline InstanceRef(const Instance<_Tp, _Type> &o) : ObjectRef(o)
+        {
+        }
+
+        /**
+         * Class constructor with an object pointer or reference
+         * @param o Object pointer or reference, it must outlive the
+         * reference
+         * @note A cast, the dynamic type is verified on de-reference as
+         * instances do
+         */
+        explicit inline InstanceRef(const ObjectPtr &o) : ObjectRef(o)
+        {
+        }
+
+        explicit inline InstanceRef(const ObjectRef &o) : ObjectRef(o)
+        {
+        }
+
+        /// Class operators
+
+        /**
+         * De-reference operator
+         * @return A const reference to the encapsulated object
+         */
+        inline const _Tp &operator*() const
+        {
+            return *this->GetObject();
+        }
+
+        /**
+         * Comparison operators with another reference of the same type,
+         * statically dispatched (see StaticObject)
+         * @param o Another reference
+         * @return Result of the comparison
+         */
+        inline bool operator==(const InstanceRef &o) const
+        {
+            return this->compare(o) == Ordering::Equal;
+        }
+
+        inline bool operator!=(const InstanceRef &o) const
+        {
+            return this->compare(o) != Ordering::Equal;
+        }
+
+        inline bool operator<(const InstanceRef &o) const
+        {
+            return this->compare(o) == Ordering::Less;
+        }
+
+        inline bool operator>(const InstanceRef &o) const
+        {
+            return this->compare(o) == Ordering::Greater;
+        }
+
+        inline bool operator<=(const InstanceRef &o) const
+        {
+            Ordering result = this->compare(o);
+            return result == Ordering::Less || result == Ordering::Equal;
+        }
+
+        inline bool operator>=(const InstanceRef &o) const
+        {
+            Ordering result = this->compare(o);
+            return result == Ordering::Greater || result == Ordering::Equal;
+        }
+
+        /// Class implementations
+
+        /**
+         * Three-way comparison method
+         * @param o Another reference of the same type
+         * @return Ordering of the object relative to the one of o
+         */
+        inline Ordering compare(const InstanceRef &o) const
+        {
+            return StaticDispatch<_Type>::Compare(this->GetObject(),
+                                                  o.GetObject());
+        }
+
+        using ObjectRef::compare;
+
+        /**
+         * Hashing method
+         * @return Hash of the object
+         */
+        inline size_t hash() const
+        {
+            return StaticDispatch<_Type>::Hash(this->GetObject());
+        }
+
+        /**
+         * Returns the dynamic object
+         * @return A const reference to the dynamic object
+         * @throw std::bad_cast If DYNOBJECTS_CHECKED_CAST is enabled and the
+         * object is not of the instance type
+         */
+        inline const _Type &GetObject() const
+        {
+#if DYNOBJECTS_CHECKED_CAST
+            return ObjectCast<_Type>(*this->m_Object);
+#else
+            return static_cast<const _Type &>(*this->m_Object);
+#endif
         }
     };
 }
@@ -144,5 +452,30 @@ const DynObjects::Instance<_Tp, _Type> &item)
    return os << *item;
 }
 
+
+// Hash implementation
+namespace std
+{
+    template<typename _Tp, typename _Type>
+    struct hash<DynObjects::Instance<_Tp, _Type>>
+    {
+        size_t operator()(
+            const DynObjects::Instance<_Tp, _Type> &__s) const noexcept
+        {
+            return __s.hash();
+        }
+    };
+
+    template<typename _Tp, typename _Type>
+    struct hash<DynObjects::InstanceRef<_Tp, _Type>>
+    {
+        size_t operator()(
+            const DynObjects::InstanceRef<_Tp, _Type> &__s) const noexcept
+        {
+            return __s.hash();
+        }
+    };
+}
+
 #endif /* DYNOBJECTS_INSTANCE_H */
 
@@ -0,0 +1,194 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   Kernels.h
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 18:40
+ */
+
+#ifndef DYNOBJECTS_KERNELS_H
+#define DYNOBJECTS_KERNELS_H
+
+/// External libs includes
+
+// C++11 standard
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+
+/**
+ * DynObjects library namespace
+ */
+namespace DynObjects
+{
+    /**
+     * Hashing and comparison kernels over contiguous payloads
+     * @note Every kernel has a scalar, an SSE2 and an AVX2 implementation,
+     * the best one the CPU supports is picked at runtime. All of them give
+     * the same results, hashes do not depend on the CPU
+     */
+    namespace Kernels
+    {
+        /**
+         * Kernel implementations, in order of preference
+         */
+        enum class Level
+        {
+            Scalar,
+            SSE2,
+            AVX2
+        };
+
+        /**
+         * Size from which payloads are hashed by the vectorized kernels
+         */
+        const size_t LongHashSize = 64;
+
+        /**
+         * Returns the kernel implementation in use
+         * @return Kernel implementation
+         */
+        Level GetLevel();
+
+        /**
+         * Selects the kernel implementation
+         * @param level Wanted kernel implementation
+         * @return Kernel implementation in use, the wanted one or the best
+         * one the CPU supports below it
+         * @note Meant for tests and benchmarks, not thread-safe with
+         * respect to running kernels
+         */
+        Level SetLevel(Level level);
+
+        /**
+         * Hashes a long range of bytes
+         * @param data Pointer to the first byte
+         * @param size Number of bytes, at least LongHashSize
+         * @return Hash of the bytes
+         */
+        size_t HashBlocks(const void *data, size_t size);
+
+        /**
+         * Hashes an array of floats, zeros of both signs hash the same
+         * @param data Pointer to the first item
+         * @param size Number of items
+         * @return Hash of the items
+         */
+        size_t HashFloats(const float *data, size_t size);
+
+        /**
+         * Hashes an array of doubles, zeros of both signs hash the same
+         * @param data Pointer to the first item
+         * @param size Number of items
+         * @return Hash of the items
+         */
+        size_t HashDoubles(const double *data, size_t size);
+
+        /**
+         * Finds the first different byte of two ranges
+         * @param a First range
+         * @param b Second range
+         * @param size Number of bytes of each range
+         * @return Index of the first different byte, or size if there is
+         * none
+         */
+        size_t MismatchBytes(const void *a, const void *b, size_t size);
+
+        /**
+         * Finds the first pair of items that are not equal
+         * @param a First array
+         * @param b Second array
+         * @param size Number of items of each array
+         * @return Index of the first pair, or size if there is none
+         * @note NaN is not equal to anything, zeros of both signs are equal
+         */
+        size_t Mismatch(const float *a, const float *b, size_t size);
+
+        size_t Mismatch(const double *a, const double *b, size_t size);
+
+        template<typename _Tp>
+        inline typename std::enable_if<std::is_integral<_Tp>::value,
+            size_t>::type Mismatch(const _Tp *a, const _Tp *b, size_t size)
+        {
+            return MismatchBytes(a, b, size * sizeof(_Tp)) / sizeof(_Tp);
+        }
+
+        /**
+         * Hashes a short range of bytes
+         * @param data Pointer to the first byte
+         * @param size Number of bytes
+         * @return Hash of the bytes
+         * @note 64 bits MurmurHash2
+         */
+        inline size_t HashShort(const void *data, size_t size)
+        {
+            const uint64_t m = 0xc6a4a7935bd1e995ULL;
+            const unsigned char *bytes =
+                static_cast<const unsigned char *>(data);
+            const unsigned char *end = bytes + (size & ~size_t(7));
+            uint64_t hash = 0xc70f6907ULL ^ (size * m);
+
+            for(; bytes != end; bytes += 8)
+            {
+                uint64_t k;
+                std::memcpy(&k, bytes, sizeof(k));
+
+                k *= m;
+                k ^= k >> 47;
+                k *= m;
+
+                hash ^= k;
+                hash *= m;
+            }
+
+            if(size & 7)
+            {
+                uint64_t k = 0;
+                std::memcpy(&k, bytes, size & 7);
+
+                hash ^= k;
+                hash *= m;
+            }
+
+            hash ^= hash >> 47;
+            hash *= m;
+            hash ^= hash >> 47;
+
+            return static_cast<size_t>(hash);
+        }
+
+        /**
+         * Hashes a range of bytes
+         * @param data Pointer to the first byte
+         * @param size Number of bytes
+         * @return Hash of the bytes, the same bytes give the same hash
+         * whatever the type they come from
+         */
+        inline size_t HashBytes(const void *data, size_t size)
+        {
+            return size < LongHashSize ?
+                HashShort(data, size) : HashBlocks(data, size);
+        }
+    }
+}
+
+#endif /* DYNOBJECTS_KERNELS_H */
+
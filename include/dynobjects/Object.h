@@ -25,11 +25,43 @@
 #ifndef DYNOBJECTS_OBJECT_H
 #define DYNOBJECTS_OBJECT_H
 
+/// Internal libs includes
+#include "Allocator.h"
+#include "Operators.h"
+#include "TypeRegistry.h"
+
 /// External libs includes
 
 // C++11 standard
+#include <atomic>
 #include <memory>
 #include <sstream>
+#include <typeinfo>
+#include <type_traits>
+
+
+/**
+ * Size in bytes of the inline storage of object pointers
+ * @note Disabled by default. Objects stored inline are copied along with
+ * the pointer, so copies of a pointer to a scalar no longer share it and
+ * modifying one through operator* leaves the others untouched. Enable it
+ * (24 fits the scalar basic types, see DYNOBJECTS_INLINE_STORAGE) only
+ * for code that never modifies scalars through shared pointers
+ */
+#ifndef DYNOBJECTS_INLINE_STORAGE_SIZE
+#define DYNOBJECTS_INLINE_STORAGE_SIZE 0
+#endif
+
+
+/**
+ * Whether or not every reference count is thread-confined
+ * @note Requires DYNOBJECTS_INTRUSIVE_REFCOUNT, object graphs can never be
+ * shared between threads
+ */
+#if defined(DYNOBJECTS_NON_ATOMIC_REFCOUNT) && \
+    !defined(DYNOBJECTS_INTRUSIVE_REFCOUNT)
+#error "DYNOBJECTS_NON_ATOMIC_REFCOUNT requires DYNOBJECTS_INTRUSIVE_REFCOUNT"
+#endif
 
 
 /**
@@ -37,125 +69,862 @@
  */
 namespace DynObjects
 {
+    class ObjectPtr;
+
+    /**
+     * Thread-confined reference counting scope
+     * @note Objects created by the current thread while a scope is alive use
+     * non-atomic reference counts, until published (see Publish). Only
+     * effective with DYNOBJECTS_INTRUSIVE_REFCOUNT
+     */
+    class LocalRefCountScope
+    {
+    public:
+        /// Class constructors
+
+        /**
+         * Class constructor
+         */
+        inline LocalRefCountScope() : m_Previous(Active())
+        {
+            Active() = true;
+        }
+
+        /**
+         * Class destructor
+         */
+        inline ~LocalRefCountScope()
+        {
+            Active() = this->m_Previous;
+        }
+
+        /// Class implementations
+
+        /**
+         * Returns whether or not a scope is alive in the current thread
+         * @return Whether or not new objects are thread-confined
+         */
+        static inline bool IsActive()
+        {
+            return Active();
+        }
+
+    private:
+        /// Class helpers
+
+        /**
+         * Current thread state
+         * @return A reference to the current thread state
+         */
+        static inline bool &Active()
+        {
+            static thread_local bool active = false;
+            return active;
+        }
+
+        /**
+         * Prevents the use of the copy constructor
+         */
+        LocalRefCountScope(const LocalRefCountScope &) = delete;
+
+        /**
+         * Prevents the use of the copy operator
+         */
+        void operator=(const LocalRefCountScope &) = delete;
+
+        /// Class attributes
+
+        /**
+         * State of the enclosing scope
+         */
+        bool m_Previous;
+    };
 
     /**
      * Object interface
+     * @note With DYNOBJECTS_INTRUSIVE_REFCOUNT the reference count lives in
+     * the object itself instead of a std::shared_ptr control block. Either
+     * way the interface takes at most ObjectOverhead bytes of every object
      */
-    class Object : public std::enable_shared_from_this<Object>
+    class Object
     {
     public:
+        /**
+         * Interface constructor
+         * @param id Type identifier of the implementation
+         */
+        inline Object(TypeId id = 0) : m_TypeId(id)
+#ifdef DYNOBJECTS_INTRUSIVE_REFCOUNT
+        , m_RefCount(InitialRefCount())
+#endif
+        {
+        }
+
+        /**
+         * Interface copy constructor
+         * @param o Object to copy
+         * @note Copies start without references
+         */
+        inline Object(const Object &o) : m_TypeId(o.m_TypeId)
+#ifdef DYNOBJECTS_INTRUSIVE_REFCOUNT
+        , m_RefCount(InitialRefCount())
+#endif
+        {
+        }
+
         /**
          * Interface destructor
          */
         virtual ~Object() = default;
 
 
+        /// Interface allocation
+
+        /**
+         * Allocates an object from the dynamic objects allocator
+         * @param size Object size
+         * @return Pointer to the object storage
+         */
+        static inline void *operator new(size_t size)
+        {
+            return Allocator::Allocate(size);
+        }
+
+        /**
+         * Returns an object storage to the dynamic objects allocator
+         * @param ptr Pointer to the object storage
+         * @param size Object size
+         */
+        static inline void operator delete(void *ptr, size_t size)
+        {
+            Allocator::Deallocate(ptr, size);
+        }
+
+        /**
+         * Placement allocation, used by the inline storage
+         * @param ptr Pointer to the object storage
+         * @return The same pointer
+         */
+        static inline void *operator new(size_t, void *ptr)
+        {
+            return ptr;
+        }
+
+        /**
+         * Placement deallocation
+         */
+        static inline void operator delete(void *, void *)
+        {
+        }
+
+
         /// Interface operators
 
+        /**
+         * Assignation operator
+         * @param o Object to assign
+         * @return A reference to itself
+         * @note References to the object are kept
+         */
+        inline Object &operator=(const Object &o)
+        {
+            this->m_TypeId = o.m_TypeId;
+            return *this;
+        }
+
         /**
          * Non equalty comparison operator
          * @param o Object to compare with
          * @return Result of the comparison
          */
-        virtual bool operator!=(const Object &o) const = 0;
+        inline bool operator!=(const Object &o) const
+        {
+            return this->compare(o) != Ordering::Equal;
+        }
 
         /**
          * Equalty comparison operator
          * @param o Object to compare with
          * @return Result of the comparison
          */
-        virtual bool operator==(const Object &o) const = 0;
+        inline bool operator==(const Object &o) const
+        {
+            return this->compare(o) == Ordering::Equal;
+        }
+
+        /**
+         * Less than comparison operator
+         * @param o Object to compare with
+         * @return Result of the comparison
+         */
+        inline bool operator<(const Object &o) const
+        {
+            return this->compare(o) == Ordering::Less;
+        }
+
+        /**
+         * Greater than comparison operator
+         * @param o Object to compare with
+         * @return Result of the comparison
+         */
+        inline bool operator>(const Object &o) const
+        {
+            return this->compare(o) == Ordering::Greater;
+        }
+
+        /**
+         * Less or equal than comparison operator
+         * @param o Object to compare with
+         * @return Result of the comparison
+         */
+        inline bool operator<=(const Object &o) const
+        {
+            Ordering result = this->compare(o);
+            return result == Ordering::Less || result == Ordering::Equal;
+        }
+
+        /**
+         * Greater or equal than comparison operator
+         * @param o Object to compare with
+         * @return Result of the comparison
+         */
+        inline bool operator>=(const Object &o) const
+        {
+            Ordering result = this->compare(o);
+            return result == Ordering::Greater || result == Ordering::Equal;
+        }
+
+
+        /// Interface methods
+
+        /**
+         * Returns object type
+         * @return Object type
+         */
+        virtual std::string GetObjectType() const = 0;
+
+        /**
+         * Returns an string representation of the object
+         * @return 
+         */
+        virtual std::string str() const
+        {
+            std::stringstream ss;
+            ss << "[";
+
+            if(this->m_TypeId)
+            {
+                ss << this->GetObjectTypeName();
+            }
+            else
+            {
+                ss << this->GetObjectType();
+            }
+
+            ss << "]" << "(" << this << ")";
+            return ss.str();
+        }
+
+        /**
+         * Three-way comparison method
+         * @param o Object to compare with
+         * @return Ordering of the object relative to o
+         * @note Objects of different types are never equal, they are ordered
+         * by type identifier (see CompareTypeId)
+         */
+        virtual Ordering compare(const Object &o) const = 0;
+
+        /**
+         * Total order method, agrees with compare wherever it is not
+         * unordered
+         * @param o Object to compare with
+         * @return Ordering of the object relative to o, never unordered
+         * @note Unordered objects are ordered by hash unless the
+         * implementation knows better, objects of equal hash being
+         * equivalent
+         */
+        virtual Ordering TotalCompare(const Object &o) const
+        {
+            Ordering result = this->compare(o);
+
+            if(result != Ordering::Unordered)
+            {
+                return result;
+            }
+
+            return Operators::Impl::HashOrdering(this->hash(), o.hash());
+        }
+
+        /**
+         * Object hashing method
+         * @return Hash of the object
+         */
+        virtual size_t hash() const = 0;
+
+        /**
+         * Returns object type identifier
+         * @return Type identifier, or zero if the implementation has none
+         */
+        inline TypeId GetObjectTypeId() const
+        {
+            return this->m_TypeId;
+        }
+
+        /**
+         * Returns object type name, without building a new string
+         * @return Registered type name, or an empty string if the
+         * implementation has no type identifier
+         */
+        const std::string &GetObjectTypeName() const;
+
+        /**
+         * Visits the object pointers held by the object
+         * @param visitor Function called with each held pointer
+         * @param context Opaque context passed to the visitor
+         */
+        virtual void ForEachChild(Operators::ObjectVisitor, void *) const
+        {
+        }
+
+        /**
+         * Returns whether or not the reference count is thread-confined
+         * @return Whether or not the object uses non-atomic counting
+         */
+        inline bool IsThreadConfined() const
+        {
+#if defined(DYNOBJECTS_NON_ATOMIC_REFCOUNT)
+            return true;
+#elif defined(DYNOBJECTS_INTRUSIVE_REFCOUNT)
+            return this->m_RefCount.load(std::memory_order_relaxed) &
+                LocalFlag;
+#else
+            return false;
+#endif
+        }
+
+        /**
+         * Switches the reference count to atomic counting
+         * @return Whether or not the count was thread-confined
+         * @note Children are not published, see Publish
+         */
+        inline bool PublishRefCount() const
+        {
+#if defined(DYNOBJECTS_INTRUSIVE_REFCOUNT) && \
+    !defined(DYNOBJECTS_NON_ATOMIC_REFCOUNT)
+            uint32_t count = this->m_RefCount.load(std::memory_order_relaxed);
+
+            if(count & LocalFlag)
+            {
+                this->m_RefCount.store(count & ~LocalFlag,
+                                       std::memory_order_release);
+                return true;
+            }
+#endif
+            return false;
+        }
+
+#ifdef DYNOBJECTS_INTRUSIVE_REFCOUNT
+        /// Reference counting
+
+        /**
+         * Acquires a reference to the object
+         */
+        inline void AddRef() const
+        {
+            uint32_t count = this->m_RefCount.load(std::memory_order_relaxed);
+
+            if(count & LocalFlag)
+            {
+                this->m_RefCount.store(count + 1, std::memory_order_relaxed);
+            }
+            else
+            {
+                this->m_RefCount.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * Releases a reference to the object, deleting it with the last one
+         */
+        inline void Release() const
+        {
+            uint32_t count = this->m_RefCount.load(std::memory_order_relaxed);
+
+            if(count & LocalFlag)
+            {
+                if(count == (LocalFlag | 1))
+                {
+                    delete this;
+                }
+                else
+                {
+                    this->m_RefCount.store(count - 1,
+                                           std::memory_order_relaxed);
+                }
+            }
+            else if(this->m_RefCount.fetch_sub(1,
+                        std::memory_order_acq_rel) == 1)
+            {
+                delete this;
+            }
+        }
+
+        /**
+         * Returns the number of references to the object
+         * @return Reference count
+         */
+        inline uint32_t GetRefCount() const
+        {
+            return this->m_RefCount.load(std::memory_order_relaxed) &
+                ~LocalFlag;
+        }
+#endif
+
+    protected:
+        /// Interface helpers
+
+        /**
+         * Orders an object of another type
+         * @param o Object of another type
+         * @return Less or Greater depending on the type identifiers, so the
+         * cross-type order is total and never throws
+         * @note Type identifiers are assigned on first use, the order is
+         * stable within a process but not across processes
+         */
+        inline Ordering CompareTypeId(const Object &o) const
+        {
+            return this->m_TypeId < o.m_TypeId ?
+                Ordering::Less : Ordering::Greater;
+        }
+
+        /// Interface attributes
+
+        /**
+         * Type identifier of the implementation
+         */
+        TypeId m_TypeId;
+
+#ifdef DYNOBJECTS_INTRUSIVE_REFCOUNT
+        /**
+         * Reference count, with LocalFlag while thread-confined
+         */
+        mutable std::atomic<uint32_t> m_RefCount;
+
+    private:
+        /// Interface helpers
+
+        /**
+         * Thread-confined reference count flag
+         */
+        static const uint32_t LocalFlag = 0x80000000u;
+
+        /**
+         * Returns the reference count of a new object
+         * @return Initial reference count
+         */
+        static inline uint32_t InitialRefCount()
+        {
+#ifdef DYNOBJECTS_NON_ATOMIC_REFCOUNT
+            return LocalFlag;
+#else
+            return LocalRefCountScope::IsActive() ? LocalFlag : 0;
+#endif
+        }
+#endif
+    };
+
+    /**
+     * Per-object overhead budget
+     * @note The virtual table pointer and the 32-bit type identifier, plus
+     * the 32-bit reference count with intrusive reference counting. Shared
+     * builds leave 4 bytes of padding the derived classes reuse, so small
+     * basic objects take no more than the budget. Heap blocks add the pool
+     * size class rounding (see Allocator) and, without intrusive reference
+     * counting, the std::shared_ptr control block
+     */
+    static const size_t ObjectOverhead = 2 * sizeof(void *);
+
+    static_assert(sizeof(Object) <= ObjectOverhead,
+                  "Object exceeds its per-object overhead budget");
+
+    /**
+     * Statically dispatched object implementation
+     * @note Implementations derive from it with themselves as _Derived and
+     * provide the non-virtual methods the virtual ones forward to:
+     * - static Ordering Compare(const _Derived &a, const _Derived &b), the
+     *   three-way comparison of two objects of the type
+     * - size_t Hash() const, the hashing method
+     * - Ordering CompareOther(const Object &o) const, optional, the order of
+     *   objects of other types
+     * - static Ordering TotalOrder(const _Derived &a, const _Derived &b),
+     *   optional, the total order of two objects of the type
+     * Code knowing the dynamic type, such as Instance, calls them directly
+     * so they are inlined, the virtual methods are only used through
+     * Object. Implementations are meant to be final
+     */
+    template<typename _Derived>
+    class StaticObject : public Object
+    {
+    public:
+        /**
+         * Class constructor
+         * @param id Type identifier of the implementation
+         */
+        inline StaticObject(TypeId id) : Object(id)
+        {
+        }
+
+        /**
+         * Three-way comparison method
+         * @param o Object to compare with
+         * @return Ordering of the object relative to o
+         */
+        virtual Ordering compare(const Object &o) const
+        {
+            const _Derived &self = static_cast<const _Derived &>(*this);
+
+            if(this->m_TypeId != o.GetObjectTypeId())
+            {
+                return self.CompareOther(o);
+            }
+
+            return _Derived::Compare(self, static_cast<const _Derived &>(o));
+        }
+
+        /**
+         * Total order method
+         * @param o Object to compare with
+         * @return Ordering of the object relative to o, never unordered
+         */
+        virtual Ordering TotalCompare(const Object &o) const
+        {
+            const _Derived &self = static_cast<const _Derived &>(*this);
+
+            if(this->m_TypeId != o.GetObjectTypeId())
+            {
+                return self.CompareOther(o);
+            }
+
+            return _Derived::TotalOrder(self, static_cast<const _Derived &>(o));
+        }
+
+        /**
+         * Object hashing method
+         * @return Hash of the object
+         */
+        virtual size_t hash() const
+        {
+            return static_cast<const _Derived &>(*this).Hash();
+        }
+
+        /**
+         * Orders an object of another type
+         * @param o Object of another type
+         * @return Ordering by type identifier (see CompareTypeId)
+         */
+        inline Ordering CompareOther(const Object &o) const
+        {
+            return this->CompareTypeId(o);
+        }
+
+        /**
+         * Total order of two objects of the type
+         * @param a First object
+         * @param b Second object
+         * @return Ordering of a relative to b, by hash if unordered
+         */
+        static inline Ordering TotalOrder(const _Derived &a, const _Derived &b)
+        {
+            Ordering result = _Derived::Compare(a, b);
+
+            if(result != Ordering::Unordered)
+            {
+                return result;
+            }
+
+            return Operators::Impl::HashOrdering(a.Hash(), b.Hash());
+        }
+    };
+
+    /**
+     * Whether or not a dynamic type is statically dispatched
+     */
+    template<typename _Type>
+    using IsStaticObject = std::is_base_of<StaticObject<_Type>, _Type>;
+
+    /**
+     * Compares and hashes objects of a known dynamic type, statically
+     * dispatched when the type allows it (see StaticObject)
+     */
+    template<typename _Type, bool = IsStaticObject<_Type>::value>
+    struct StaticDispatch
+    {
+        static inline Ordering Compare(const _Type &a, const _Type &b)
+        {
+            return _Type::Compare(a, b);
+        }
+
+        static inline size_t Hash(const _Type &o)
+        {
+            return o.Hash();
+        }
+    };
+
+    template<typename _Type>
+    struct StaticDispatch<_Type, false>
+    {
+        static inline Ordering Compare(const _Type &a, const _Type &b)
+        {
+            return a.compare(b);
+        }
+
+        static inline size_t Hash(const _Type &o)
+        {
+            return o.hash();
+        }
+    };
+
+    /**
+     * Casts an object to its dynamic type
+     * @param o Object to cast
+     * @return A const reference to the casted object
+     * @throw std::bad_cast If the object is not of the given type
+     */
+    template<typename _Type>
+    inline const _Type &ObjectCast(const Object &o)
+    {
+        if(o.GetObjectTypeId() != GetTypeId<_Type>())
+        {
+            throw std::bad_cast();
+        }
+
+        return static_cast<const _Type &>(o);
+    }
+
+    /**
+     * Casts an object to its dynamic type
+     * @param o Object to cast
+     * @return A reference to the casted object
+     * @throw std::bad_cast If the object is not of the given type
+     */
+    template<typename _Type>
+    inline _Type &ObjectCast(Object &o)
+    {
+        return const_cast<_Type &>(
+            ObjectCast<_Type>(static_cast<const Object &>(o)));
+    }
+
+    /**
+     * Inline storage trait
+     * @note Specialized by the dynamic types allowed to live inside the
+     * inline buffer of an ObjectPtr instead of the heap. Strings are not,
+     * a string Generic is larger than the buffer
+     */
+    template<typename _Type>
+    struct InlineStorable : public std::false_type
+    {
+    };
+
+    /**
+     * Custom construction trait
+     * @note Specialized by the dynamic types that can not be built with a
+     * plain new, such as the ones sized by their content. Specializations
+     * provide a static Create method taking the constructor arguments and
+     * returning the object pointer
+     */
+    template<typename _Type>
+    struct ObjectFactory : public std::false_type
+    {
+    };
+
+    /**
+     * In-place construction tag
+     */
+    template<typename _Type>
+    struct InPlace
+    {
+    };
+
+    /**
+     * Whether a constructor argument list is a single object of a base type
+     * @note Keeps variadic constructors from hijacking copies and casts
+     */
+    template<typename _Base, typename... Args>
+    struct IsSingleOf : public std::false_type
+    {
+    };
+
+    template<typename _Base, typename _Arg>
+    struct IsSingleOf<_Base, _Arg> :
+    public std::is_base_of<_Base, typename std::decay<_Arg>::type>
+    {
+    };
+
+    /**
+     * Object pointer
+     * @note Objects are shared by every copy of the pointer. With inline
+     * storage enabled (see DYNOBJECTS_INLINE_STORAGE_SIZE) small values
+     * (see InlineStorable) are stored inside the pointer itself and have
+     * value semantics instead
+     */
+    class ObjectPtr
+    {
+    public:
+        /**
+         * Size of the inline storage buffer
+         */
+        static const size_t InlineSize = DYNOBJECTS_INLINE_STORAGE_SIZE;
 
         /**
-         * Less than comparison operator
-         * @param o Object to compare with
-         * @return Result of the comparison
+         * Whether or not a dynamic type is stored inline
          */
-        virtual bool operator<(const Object &o) const = 0;
+        template<typename _Type>
+        using IsInline = std::integral_constant<bool, InlineSize != 0 &&
+            InlineStorable<_Type>::value && sizeof(_Type) <= InlineSize &&
+            alignof(_Type) <= alignof(void *)>;
+
+        /// Class constructors
 
         /**
-         * Greater than comparison operator
-         * @param o Object to compare with
-         * @return Result of the comparison
+         * Default class constructor
          */
-        virtual bool operator>(const Object &o) const = 0;
+        inline ObjectPtr() : m_Object(nullptr)
+        {
+            this->Reset();
+        }
 
+#ifdef DYNOBJECTS_INTRUSIVE_REFCOUNT
         /**
-         * Less or equal than comparison operator
-         * @param o Object to compare with
-         * @return Result of the comparison
+         * Class constructor with a raw pointer
+         * @param ptr Heap allocated object, a reference is acquired
          */
-        virtual bool operator<=(const Object &o) const = 0;
+        explicit inline ObjectPtr(Object *ptr) : m_Object(ptr)
+        {
+            this->Reset();
 
+            if(ptr)
+            {
+                ptr->AddRef();
+            }
+        }
+#else
         /**
-         * Greater or equal than comparison operator
-         * @param o Object to compare with
-         * @return Result of the comparison
+         * Copy class constructor
+         * @param ptr Shared pointer
          */
-        virtual bool operator>=(const Object &o) const = 0;
-
-
-        /// Interface methods
+        template<typename T>
+        inline ObjectPtr(const std::shared_ptr<T> &ptr) : m_Object(ptr.get())
+        {
+            this->Reset();
+            new (&this->m_Pointer) std::shared_ptr<Object>(ptr);
+        }
 
         /**
-         * Returns object type
-         * @return Object type
+         * Move class constructor
+         * @param ptr Shared pointer to move
          */
-        virtual std::string GetObjectType() const = 0;
+        template<typename T>
+        inline ObjectPtr(std::shared_ptr<T> &&ptr) : m_Object(ptr.get())
+        {
+            this->Reset();
+            new (&this->m_Pointer) std::shared_ptr<Object>(std::move(ptr));
+        }
+#endif
 
         /**
-         * Returns an string representation of the object
-         * @return 
+         * In-place class constructor
+         * @param args List of encapsulated object constructor arguments
          */
-        virtual std::string str() const
+        template<typename _Type, typename... Args>
+        inline ObjectPtr(InPlace<_Type>, Args&&... args) : m_Object(nullptr)
         {
-            std::stringstream ss;
-            ss << "[" << this->GetObjectType() << "]" << "(" << this << ")";
-
-            return ss.str();
+            this->Reset();
+            this->Construct<_Type>(ConstructKind<_Type>(),
+                                   std::forward<Args>(args)...);
         }
 
         /**
-         * Object hashing method
-         * @return Hash of the object
+         * Copy class constructor
+         * @param o Object pointer to copy
          */
-        virtual size_t hash() const = 0;
-    };
+        inline ObjectPtr(const ObjectPtr &o)
+        {
+            this->CopyFrom(o);
+        }
 
-    /**
-     * Object pointer
-     */
-    class ObjectPtr
-    {
-    public:
-        /// Class constructors
+        /**
+         * Move class constructor
+         * @param o Object pointer to move
+         */
+        inline ObjectPtr(ObjectPtr &&o) noexcept
+        {
+            this->MoveFrom(o);
+        }
 
         /**
-         * Default class constructor
+         * Class destructor
          */
-        ObjectPtr() = default;
+        inline ~ObjectPtr()
+        {
+            this->Destroy();
+        }
 
         /**
-         * Copy class constructor
-         * @param ptr Shared pointer
+         * Copy assignation operator
+         * @param o Object pointer to copy
+         * @return A reference to itself
+         * @note o may live inside the object released, so it is copied
+         * before releasing it
          */
-        template<typename T>
-        inline ObjectPtr(const std::shared_ptr<T> &ptr) : m_Pointer(ptr)
+        inline ObjectPtr &operator=(const ObjectPtr &o)
         {
+            if(this != &o)
+            {
+                ObjectPtr copy(o);
+                this->Destroy();
+                this->MoveFrom(copy);
+            }
+
+            return *this;
         }
 
         /**
-         * Class destructor
+         * Move assignation operator
+         * @param o Object pointer to move
+         * @return A reference to itself
+         * @note o may live inside the object released, so it is moved
+         * before releasing it
          */
-        virtual ~ObjectPtr() = default;
+        inline ObjectPtr &operator=(ObjectPtr &&o) noexcept
+        {
+            if(this != &o)
+            {
+                ObjectPtr moved(std::move(o));
+                this->Destroy();
+                this->MoveFrom(moved);
+            }
+
+            return *this;
+        }
 
         /**
          * Casting operator to shared pointer
          * @return Shared pointer
+         * @note Inline values are copied into a new heap object
          */
         inline operator std::shared_ptr<Object>() const
         {
+#if DYNOBJECTS_INLINE_STORAGE_SIZE
+            if(this->m_Inline)
+            {
+                return Share(this->m_Inline->Box(&this->m_Buffer));
+            }
+#endif
+#ifdef DYNOBJECTS_INTRUSIVE_REFCOUNT
+            return Share(this->m_Object);
+#else
             return this->m_Pointer;
+#endif
         }
 
         /**
@@ -164,7 +933,7 @@ namespace DynObjects
          */
         inline Object &operator*()
         {
-            return *this->m_Pointer.get();
+            return *this->m_Object;
         }
 
         /**
@@ -173,7 +942,28 @@ namespace DynObjects
          */
         inline const Object &operator*() const
         {
-            return *this->m_Pointer.get();
+            return *this->m_Object;
+        }
+
+        /**
+         * Three-way comparison method
+         * @param o Object pointer to compare with
+         * @return Ordering of the object relative to the one of o
+         */
+        inline Ordering compare(const ObjectPtr &o) const
+        {
+            return this->operator*().compare(o.operator*());
+        }
+
+        /**
+         * Total order method
+         * @param o Object pointer to compare with
+         * @return Ordering of the object relative to the one of o, never
+         * unordered (see Object::TotalCompare)
+         */
+        inline Ordering TotalCompare(const ObjectPtr &o) const
+        {
+            return this->operator*().TotalCompare(o.operator*());
         }
 
         /**
@@ -233,7 +1023,7 @@ namespace DynObjects
          */
         inline bool operator>=(const ObjectPtr &o) const
         {
-            this->operator*() >= o.operator*();
+            return this->operator*() >= o.operator*();
         }
 
         /**
@@ -242,8 +1032,46 @@ namespace DynObjects
          */
         inline operator bool() const
         {
-            return this->m_Pointer.operator bool();
+            return this->m_Object != nullptr;
+        }
+
+        /**
+         * Returns whether or not the object is stored inline
+         * @return Whether or not the object lives inside the pointer
+         */
+        inline bool IsInlined() const
+        {
+#if DYNOBJECTS_INLINE_STORAGE_SIZE
+            return this->m_Inline != nullptr;
+#else
+            return false;
+#endif
+        }
+
+#ifdef DYNOBJECTS_INTRUSIVE_REFCOUNT
+        /**
+         * Returns the object with a new reference, owned by the caller
+         * @return Heap object, or null. Inline values are copied into a new
+         * heap object
+         */
+        inline Object *Acquire() const
+        {
+            Object *ptr = this->m_Object;
+
+#if DYNOBJECTS_INLINE_STORAGE_SIZE
+            if(this->m_Inline)
+            {
+                ptr = this->m_Inline->Box(&this->m_Buffer);
+            }
+#endif
+            if(ptr)
+            {
+                ptr->AddRef();
+            }
+
+            return ptr;
         }
+#endif
 
         /**
          * 
@@ -251,17 +1079,419 @@ namespace DynObjects
          */
         std::string GetObjectType() const
         {
-            return "Ptr<" + this->operator*().GetObjectType() + ">";
+            const TypeInfo *info =
+                TypeRegistry::Find(this->operator*().GetObjectTypeId());
+
+            return info ? info->GetPointerName() :
+                "Ptr<" + this->operator*().GetObjectType() + ">";
+        }
+
+    protected:
+        /// Class helpers
+
+#if DYNOBJECTS_INLINE_STORAGE_SIZE
+        /**
+         * Inline object operations
+         */
+        struct InlineOps
+        {
+            /**
+             * Copy constructs an inline object
+             */
+            Object *(*Copy)(void *dst, const void *src);
+
+            /**
+             * Move constructs an inline object
+             */
+            Object *(*Move)(void *dst, void *src);
+
+            /**
+             * Copies an inline object into the heap
+             */
+            Object *(*Box)(const void *src);
+        };
+
+        /**
+         * Inline object operations for a given dynamic type
+         */
+        template<typename _Type>
+        struct InlineOpsFor
+        {
+            static Object *Copy(void *dst, const void *src)
+            {
+                return new (dst) _Type(*static_cast<const _Type *>(src));
+            }
+
+            static Object *Move(void *dst, void *src)
+            {
+                return new (dst) _Type(std::move(*static_cast<_Type *>(src)));
+            }
+
+            static Object *Box(const void *src)
+            {
+                return new _Type(*static_cast<const _Type *>(src));
+            }
+
+            static const InlineOps Ops;
+        };
+
+        /**
+         * Constructs the object inside the inline buffer
+         * @param args List of encapsulated object constructor arguments
+         */
+        template<typename _Type, typename... Args>
+        inline void Construct(std::true_type, Args&&... args)
+        {
+            this->m_Object =
+                new (&this->m_Buffer) _Type(std::forward<Args>(args)...);
+            this->m_Inline = &InlineOpsFor<_Type>::Ops;
+        }
+#endif
+
+        /**
+         * Construction through the object factory tag
+         */
+        struct FactoryConstruct
+        {
+        };
+
+        /**
+         * Construction tag of a dynamic type
+         */
+        template<typename _Type>
+        using ConstructKind = typename std::conditional<
+            ObjectFactory<_Type>::value, FactoryConstruct,
+            IsInline<_Type>>::type;
+
+        /**
+         * Constructs the object through its factory
+         * @param args List of encapsulated object constructor arguments
+         */
+        template<typename _Type, typename... Args>
+        inline void Construct(FactoryConstruct, Args&&... args)
+        {
+            *this = ObjectFactory<_Type>::Create(std::forward<Args>(args)...);
+        }
+
+        /**
+         * Constructs the object in the heap
+         * @param args List of encapsulated object constructor arguments
+         */
+        template<typename _Type, typename... Args>
+        inline void Construct(std::false_type, Args&&... args)
+        {
+#ifdef DYNOBJECTS_INTRUSIVE_REFCOUNT
+            this->m_Object = new _Type(std::forward<Args>(args)...);
+            this->m_Object->AddRef();
+#else
+            std::shared_ptr<_Type> ptr = std::allocate_shared<_Type>(
+                PoolAllocator<_Type>(), std::forward<Args>(args)...);
+
+            this->m_Object = ptr.get();
+            this->m_Pointer = std::move(ptr);
+#endif
+        }
+
+        /**
+         * Initializes the storage of an unitialized pointer to the heap
+         * @note Leaves the object pointer untouched
+         */
+        inline void Reset()
+        {
+#if DYNOBJECTS_INLINE_STORAGE_SIZE
+            this->m_Inline = nullptr;
+#endif
+#ifndef DYNOBJECTS_INTRUSIVE_REFCOUNT
+            new (&this->m_Pointer) std::shared_ptr<Object>();
+#endif
+        }
+
+        /**
+         * Copies another object pointer into an uninitialized one
+         * @param o Object pointer to copy
+         */
+        inline void CopyFrom(const ObjectPtr &o)
+        {
+            this->m_Object = o.m_Object;
+            this->Reset();
+
+#if DYNOBJECTS_INLINE_STORAGE_SIZE
+            if(o.m_Inline)
+            {
+                this->m_Inline = o.m_Inline;
+                this->m_Object = o.m_Inline->Copy(&this->m_Buffer, &o.m_Buffer);
+                return;
+            }
+#endif
+#ifdef DYNOBJECTS_INTRUSIVE_REFCOUNT
+            if(this->m_Object)
+            {
+                this->m_Object->AddRef();
+            }
+#else
+            this->m_Pointer = o.m_Pointer;
+#endif
+        }
+
+        /**
+         * Moves another object pointer into an uninitialized one
+         * @param o Object pointer to move
+         */
+        inline void MoveFrom(ObjectPtr &o)
+        {
+            this->m_Object = o.m_Object;
+            this->Reset();
+
+#if DYNOBJECTS_INLINE_STORAGE_SIZE
+            if(o.m_Inline)
+            {
+                this->m_Inline = o.m_Inline;
+                this->m_Object = o.m_Inline->Move(&this->m_Buffer, &o.m_Buffer);
+                return;
+            }
+#endif
+#ifndef DYNOBJECTS_INTRUSIVE_REFCOUNT
+            this->m_Pointer = std::move(o.m_Pointer);
+#endif
+            o.m_Object = nullptr;
+        }
+
+        /**
+         * Destroys the stored object reference
+         */
+        inline void Destroy()
+        {
+#if DYNOBJECTS_INLINE_STORAGE_SIZE
+            if(this->m_Inline)
+            {
+                this->m_Object->~Object();
+                return;
+            }
+#endif
+#ifdef DYNOBJECTS_INTRUSIVE_REFCOUNT
+            if(this->m_Object)
+            {
+                this->m_Object->Release();
+            }
+#else
+            this->m_Pointer.~shared_ptr();
+#endif
+        }
+
+        /**
+         * Shares a heap object through a shared pointer
+         * @param ptr Heap object
+         * @return Shared pointer
+         */
+        static inline std::shared_ptr<Object> Share(Object *ptr)
+        {
+#ifdef DYNOBJECTS_INTRUSIVE_REFCOUNT
+            if(ptr)
+            {
+                ptr->AddRef();
+            }
+
+            return std::shared_ptr<Object>(ptr, [](Object *o)
+            {
+                if(o)
+                {
+                    o->Release();
+                }
+            });
+#else
+            return std::shared_ptr<Object>(ptr);
+#endif
+        }
+
+        /// Class attributes
+
+        /**
+         * Pointer to the object, either inline or in the heap
+         */
+        Object *m_Object;
+
+#if DYNOBJECTS_INLINE_STORAGE_SIZE
+        /**
+         * Inline object operations, or null if the object is in the heap
+         */
+        const InlineOps *m_Inline;
+#endif
+
+#ifdef DYNOBJECTS_INTRUSIVE_REFCOUNT
+#if DYNOBJECTS_INLINE_STORAGE_SIZE
+        /**
+         * Inline object storage
+         */
+        std::aligned_storage<InlineSize, alignof(void *)>::type m_Buffer;
+#endif
+#else
+        union
+        {
+            /**
+             * Shared pointer
+             */
+            std::shared_ptr<Object> m_Pointer;
+
+#if DYNOBJECTS_INLINE_STORAGE_SIZE
+            /**
+             * Inline object storage
+             */
+            std::aligned_storage<InlineSize, alignof(void *)>::type m_Buffer;
+#endif
+        };
+#endif
+    };
+
+#if DYNOBJECTS_INLINE_STORAGE_SIZE
+    template<typename _Type>
+    const ObjectPtr::InlineOps ObjectPtr::InlineOpsFor<_Type>::Ops =
+    {
+        &ObjectPtr::InlineOpsFor<_Type>::Copy,
+        &ObjectPtr::InlineOpsFor<_Type>::Move,
+        &ObjectPtr::InlineOpsFor<_Type>::Box
+    };
+#endif
+
+    /**
+     * Borrowed object reference
+     * @note Neither owns the object nor touches its reference count, so it
+     * is only valid while the object pointer it was made from is alive and
+     * unchanged, inline objects live inside that pointer. Meant to pass
+     * objects to lookups, comparisons and read-only traversals
+     */
+    class ObjectRef
+    {
+    public:
+        /// Class constructors
+
+        /**
+         * Default class constructor, the null reference
+         */
+        inline ObjectRef() : m_Object(nullptr)
+        {
+        }
+
+        /**
+         * Class constructor with an object pointer
+         * @param ptr Object pointer, it must outlive the reference
+         */
+        inline ObjectRef(const ObjectPtr &ptr) :
+        m_Object(ptr ? &*ptr : nullptr)
+        {
+        }
+
+        /**
+         * Class constructor with an object
+         * @param o Object, it must outlive the reference
+         */
+        explicit inline ObjectRef(const Object &o) : m_Object(&o)
+        {
+        }
+
+        /// Class operators
+
+        /**
+         * De-reference operator
+         * @return A const reference to the object
+         */
+        inline const Object &operator*() const
+        {
+            return *this->m_Object;
+        }
+
+        /**
+         * Bool operator
+         * @return Whether or not the reference is not null
+         */
+        explicit inline operator bool() const
+        {
+            return this->m_Object != nullptr;
+        }
+
+        /// Class implementations
+
+        /**
+         * Three-way comparison method
+         * @param o Object reference to compare with
+         * @return Ordering of the object relative to the one of o
+         */
+        inline Ordering compare(const ObjectRef &o) const
+        {
+            return this->m_Object->compare(*o.m_Object);
+        }
+
+        /**
+         * Hashing method
+         * @return Hash of the object
+         */
+        inline size_t hash() const
+        {
+            return this->m_Object->hash();
         }
 
     protected:
         /// Class attributes
 
         /**
-         * Shared pointer
+         * Referenced object
          */
-        std::shared_ptr<Object> m_Pointer;
+        const Object *m_Object;
     };
+
+    /**
+     * Comparison operators of object references
+     * @note Object pointers are compared as references when compared with
+     * one, without copying them
+     */
+    inline bool operator==(const ObjectRef &a, const ObjectRef &b)
+    {
+        return *a == *b;
+    }
+
+    inline bool operator!=(const ObjectRef &a, const ObjectRef &b)
+    {
+        return *a != *b;
+    }
+
+    inline bool operator<(const ObjectRef &a, const ObjectRef &b)
+    {
+        return *a < *b;
+    }
+
+    inline bool operator>(const ObjectRef &a, const ObjectRef &b)
+    {
+        return *a > *b;
+    }
+
+    inline bool operator<=(const ObjectRef &a, const ObjectRef &b)
+    {
+        return *a <= *b;
+    }
+
+    inline bool operator>=(const ObjectRef &a, const ObjectRef &b)
+    {
+        return *a >= *b;
+    }
+
+    /**
+     * Publishes an object graph, switching every reachable thread-confined
+     * reference count to atomic counting
+     * @param root Root of the graph
+     * @note Must be called by the thread that created the graph, before
+     * sharing it with other threads
+     */
+    void Publish(const ObjectPtr &root);
+
+    /**
+     * Creates a new dynamic object
+     * @param args List of encapsulated object constructor arguments
+     * @return Pointer to the new object
+     */
+    template<typename _Type, typename... Args>
+    inline ObjectPtr MakeObject(Args&&... args)
+    {
+        return ObjectPtr(InPlace<_Type>(), std::forward<Args>(args)...);
+    }
 };
 
 
@@ -274,6 +1504,9 @@ namespace DynObjects
 std::ostream & operator<<(std::ostream &os,
         const DynObjects::ObjectPtr &item);
 
+std::ostream & operator<<(std::ostream &os,
+        const DynObjects::ObjectRef &item);
+
 
 // Hash implementation
 namespace std
@@ -289,6 +1522,15 @@ namespace std
             return (*__s).hash();
         }
     };
+
+    template<>
+    struct hash<DynObjects::ObjectRef>
+    {
+        size_t operator()(const DynObjects::ObjectRef &__s) const noexcept
+        {
+            return __s.hash();
+        }
+    };
 }
 
 #endif /* DYNOBJECTS_OBJECT_H */
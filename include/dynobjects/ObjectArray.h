@@ -0,0 +1,594 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   ObjectArray.h
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 20:10
+ */
+
+#ifndef DYNOBJECTS_OBJECTARRAY_H
+#define DYNOBJECTS_OBJECTARRAY_H
+
+/// Internal libs includes
+#include "Basic.h"
+#include "Instance.h"
+#include "Object.h"
+#include "Operators.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+/**
+ * DynObjects library namespace
+ */
+namespace DynObjects
+{
+    /**
+     * Typed view over contiguous items, it does not own them
+     */
+    template<typename T>
+    class ArraySpan
+    {
+    public:
+        /// Types definitions
+
+        typedef T value_type;
+        typedef T *iterator;
+        typedef T *const_iterator;
+
+        /// Class constructors
+
+        /**
+         * Class default constructor, an empty span
+         */
+        inline ArraySpan() : m_Data(nullptr), m_Size(0)
+        {
+        }
+
+        /**
+         * Class constructor
+         * @param data Pointer to the first item
+         * @param size Number of items
+         */
+        inline ArraySpan(T *data, size_t size) : m_Data(data), m_Size(size)
+        {
+        }
+
+        /**
+         * Class conversion constructor, from a span of non-const items
+         * @param o Span to convert
+         */
+        template<typename U, typename = typename std::enable_if<
+            std::is_same<const U, T>::value>::type>
+        inline ArraySpan(const ArraySpan<U> &o) :
+        m_Data(o.data()), m_Size(o.size())
+        {
+        }
+
+        /// Class operators
+
+        /**
+         * Subscript operator
+         * @param index Item index, not checked
+         * @return A reference to the item
+         */
+        inline T &operator[](size_t index) const
+        {
+            return this->m_Data[index];
+        }
+
+        /// Class implementations
+
+        inline T *data() const
+        {
+            return this->m_Data;
+        }
+
+        inline size_t size() const
+        {
+            return this->m_Size;
+        }
+
+        inline bool empty() const
+        {
+            return this->m_Size == 0;
+        }
+
+        inline iterator begin() const
+        {
+            return this->m_Data;
+        }
+
+        inline iterator end() const
+        {
+            return this->m_Data + this->m_Size;
+        }
+
+    private:
+        /// Class attributes
+
+        /**
+         * Pointer to the first item
+         */
+        T *m_Data;
+
+        /**
+         * Number of items
+         */
+        size_t m_Size;
+    };
+
+    /**
+     * View over contiguous numbers that boxes each of them on access
+     * @note Items are boxed in Basic objects when de-referenced, the view
+     * does not own them
+     */
+    template<typename T>
+    class BoxedSpan
+    {
+    public:
+        /**
+         * Boxing iterator
+         */
+        class const_iterator
+        {
+        public:
+            /// Types definitions
+
+            typedef std::random_access_iterator_tag iterator_category;
+            typedef ObjectPtr value_type;
+            typedef ptrdiff_t difference_type;
+            typedef const ObjectPtr *pointer;
+            typedef ObjectPtr reference;
+
+            /// Class constructors
+
+            inline explicit const_iterator(const T *item = nullptr) :
+            m_Item(item)
+            {
+            }
+
+            /// Class operators
+
+            /**
+             * De-reference operator
+             * @return The item, boxed
+             */
+            inline ObjectPtr operator*() const
+            {
+                return MakeObject<Basic<T>>(*this->m_Item);
+            }
+
+            inline ObjectPtr operator[](difference_type n) const
+            {
+                return MakeObject<Basic<T>>(this->m_Item[n]);
+            }
+
+            inline const_iterator &operator++()
+            {
+                ++this->m_Item;
+                return *this;
+            }
+
+            inline const_iterator operator++(int)
+            {
+                return const_iterator(this->m_Item++);
+            }
+
+            inline const_iterator &operator--()
+            {
+                --this->m_Item;
+                return *this;
+            }
+
+            inline const_iterator operator--(int)
+            {
+                return const_iterator(this->m_Item--);
+            }
+
+            inline const_iterator &operator+=(difference_type n)
+            {
+                this->m_Item += n;
+                return *this;
+            }
+
+            inline const_iterator &operator-=(difference_type n)
+            {
+                this->m_Item -= n;
+                return *this;
+            }
+
+            inline const_iterator operator+(difference_type n) const
+            {
+                return const_iterator(this->m_Item + n);
+            }
+
+            inline const_iterator operator-(difference_type n) const
+            {
+                return const_iterator(this->m_Item - n);
+            }
+
+            inline difference_type operator-(const const_iterator &o) const
+            {
+                return this->m_Item - o.m_Item;
+            }
+
+            inline bool operator==(const const_iterator &o) const
+            {
+                return this->m_Item == o.m_Item;
+            }
+
+            inline bool operator!=(const const_iterator &o) const
+            {
+                return this->m_Item != o.m_Item;
+            }
+
+            inline bool operator<(const const_iterator &o) const
+            {
+                return this->m_Item < o.m_Item;
+            }
+
+        private:
+            /// Class attributes
+
+            /**
+             * Current item
+             */
+            const T *m_Item;
+        };
+
+        typedef const_iterator iterator;
+        typedef ObjectPtr value_type;
+
+        /// Class constructors
+
+        /**
+         * Class constructor
+         * @param items Items to box on access
+         */
+        inline explicit BoxedSpan(ArraySpan<const T> items) : m_Items(items)
+        {
+        }
+
+        /// Class operators
+
+        /**
+         * Subscript operator
+         * @param index Item index, not checked
+         * @return The item, boxed
+         */
+        inline ObjectPtr operator[](size_t index) const
+        {
+            return MakeObject<Basic<T>>(this->m_Items[index]);
+        }
+
+        /// Class implementations
+
+        inline size_t size() const
+        {
+            return this->m_Items.size();
+        }
+
+        inline bool empty() const
+        {
+            return this->m_Items.empty();
+        }
+
+        inline const_iterator begin() const
+        {
+            return const_iterator(this->m_Items.begin());
+        }
+
+        inline const_iterator end() const
+        {
+            return const_iterator(this->m_Items.end());
+        }
+
+    private:
+        /// Class attributes
+
+        /**
+         * Items to box on access
+         */
+        ArraySpan<const T> m_Items;
+    };
+
+    /**
+     * Array of unboxed numbers
+     * @note Numbers are stored contiguously, not as Basic objects. Typed
+     * spans (see GetSpan) give direct access to them, and boxed views
+     * (see GetBoxed, GetItem) box them on demand. Arrays are ordered and
+     * hashed as the sequence of their numbers
+     */
+    template<typename T>
+    class ObjectArray : public Object
+    {
+        static_assert(std::is_arithmetic<T>::value &&
+                      !std::is_same<T, bool>::value,
+                      "Object arrays hold numbers only");
+
+    public:
+        /// Types definitions
+
+        typedef T value_type;
+        typedef std::vector<T> container_type;
+
+        /// Class constructors
+
+        /**
+         * Class default constructor, an empty array
+         */
+        ObjectArray() : Object(GetTypeId<ObjectArray>())
+        {
+        }
+
+        /**
+         * Class constructor
+         * @param size Number of items
+         * @param value Value of every item
+         */
+        ObjectArray(size_t size, const T &value = T()) :
+        Object(GetTypeId<ObjectArray>()), m_Data(size, value)
+        {
+        }
+
+        /**
+         * Class constructor
+         * @param items Items to copy
+         */
+        ObjectArray(ArraySpan<const T> items) :
+        Object(GetTypeId<ObjectArray>()), m_Data(items.begin(), items.end())
+        {
+        }
+
+        /**
+         * Class constructor
+         * @param items Items to copy
+         */
+        ObjectArray(std::initializer_list<T> items) :
+        Object(GetTypeId<ObjectArray>()), m_Data(items)
+        {
+        }
+
+        /**
+         * Class constructor
+         * @param items Items to copy
+         */
+        ObjectArray(const container_type &items) :
+        Object(GetTypeId<ObjectArray>()), m_Data(items)
+        {
+        }
+
+        /**
+         * Class constructor
+         * @param items Items to move
+         */
+        ObjectArray(container_type &&items) :
+        Object(GetTypeId<ObjectArray>()), m_Data(std::move(items))
+        {
+        }
+
+        /**
+         * Class copy constructor
+         * @param o Object to copy
+         */
+        ObjectArray(const ObjectArray &o) = default;
+
+        /**
+         * Class move constructor
+         * @param o Object to move
+         */
+        ObjectArray(ObjectArray &&o) = default;
+
+        /**
+         * Class destructor
+         */
+        virtual ~ObjectArray()
+        {
+        }
+
+        /// Class operators
+
+        /**
+         * De-reference operator
+         * @return A reference to the contained items
+         */
+        inline container_type &operator*()
+        {
+            return this->m_Data;
+        }
+
+        /**
+         * De-reference operator
+         * @return A const reference to the contained items
+         */
+        inline const container_type &operator*() const
+        {
+            return this->m_Data;
+        }
+
+        /**
+         * Copy assignation operator
+         * @param o Object to be assigned
+         * @return A reference to itself
+         */
+        ObjectArray &operator=(const ObjectArray &o) = default;
+
+        /**
+         * Move assignation operator
+         * @param o Object to be moved
+         * @return A reference to itself
+         */
+        ObjectArray &operator=(ObjectArray &&o) = default;
+
+        /// Class implementations
+
+        /**
+         * Three-way comparison method
+         * @param o Object to compare
+         * @return Ordering of the object relative to o
+         */
+        virtual Ordering compare(const Object &o) const
+        {
+            if(this->m_TypeId != o.GetObjectTypeId())
+            {
+                return this->CompareTypeId(o);
+            }
+
+            return Operators::ThreeWay<container_type>::Compare(this->m_Data,
+                static_cast<const ObjectArray &>(o).m_Data);
+        }
+
+        /**
+         * Total order method
+         * @param o Object to compare
+         * @return Ordering of the object relative to o, never unordered
+         */
+        virtual Ordering TotalCompare(const Object &o) const
+        {
+            if(this->m_TypeId != o.GetObjectTypeId())
+            {
+                return this->CompareTypeId(o);
+            }
+
+            return Operators::TotalOrder<container_type>::Compare(
+                this->m_Data, static_cast<const ObjectArray &>(o).m_Data);
+        }
+
+        virtual std::string GetObjectType() const
+        {
+            return GetTypeInfo<ObjectArray>().GetName();
+        }
+
+        /**
+         * Hashing method
+         * @return Hash of the object
+         */
+        virtual size_t hash() const
+        {
+            return Operators::Hash<container_type>()(this->m_Data);
+        }
+
+        /**
+         * Returns the number of items
+         * @return Number of items
+         */
+        inline size_t GetSize() const
+        {
+            return this->m_Data.size();
+        }
+
+        /**
+         * Returns a typed view over the items
+         * @return Span over the items, invalidated when the array grows
+         */
+        inline ArraySpan<T> GetSpan()
+        {
+            return ArraySpan<T>(this->m_Data.data(), this->m_Data.size());
+        }
+
+        /**
+         * Returns a typed view over the items
+         * @return Span over the items, invalidated when the array grows
+         */
+        inline ArraySpan<const T> GetSpan() const
+        {
+            return ArraySpan<const T>(this->m_Data.data(),
+                                      this->m_Data.size());
+        }
+
+        /**
+         * Returns a view that boxes the items on access
+         * @return Boxed view, invalidated when the array grows
+         */
+        inline BoxedSpan<T> GetBoxed() const
+        {
+            return BoxedSpan<T>(this->GetSpan());
+        }
+
+        /**
+         * Returns an item, boxed
+         * @param index Item index
+         * @return A new Basic object holding the item
+         * @throw std::out_of_range If the index is out of range
+         */
+        inline ObjectPtr GetItem(size_t index) const
+        {
+            return MakeObject<Basic<T>>(this->m_Data.at(index));
+        }
+
+        /**
+         * Replaces an item with the value of a boxed one
+         * @param index Item index
+         * @param item Basic object holding the new value
+         * @throw std::out_of_range If the index is out of range
+         * @throw std::bad_cast If the item is not a Basic object of the
+         * array value type
+         */
+        inline void SetItem(size_t index, const ObjectPtr &item)
+        {
+            this->m_Data.at(index) = *ObjectCast<Basic<T>>(*item);
+        }
+
+    protected:
+
+        /// Class attributes
+
+        /**
+         * Contained items
+         */
+        container_type m_Data;
+    };
+
+    /**
+     * Object array instances alias
+     */
+    template<typename T>
+    using ArrayInstance = Instance<std::vector<T>, ObjectArray<T>>;
+
+    /// Standard object array types definitions
+
+    // Signed types
+    typedef ArrayInstance<int8_t> Int8Array;
+    typedef ArrayInstance<int16_t> Int16Array;
+    typedef ArrayInstance<int32_t> Int32Array;
+    typedef ArrayInstance<int64_t> Int64Array;
+
+    // Unsigned types
+    typedef ArrayInstance<uint8_t> UInt8Array;
+    typedef ArrayInstance<uint16_t> UInt16Array;
+    typedef ArrayInstance<uint32_t> UInt32Array;
+    typedef ArrayInstance<uint64_t> UInt64Array;
+
+    // FPU types
+    typedef ArrayInstance<float> FloatArray;
+    typedef ArrayInstance<double> DoubleArray;
+}
+
+#endif /* DYNOBJECTS_OBJECTARRAY_H */
+
@@ -25,11 +25,42 @@
 #ifndef DYNOBJECTS_OPERATORS_H
 #define DYNOBJECTS_OPERATORS_H
 
+/// Internal libs includes
+#include "Kernels.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 /**
  * DynObjects library namespace
  */
 namespace DynObjects
 {
+    class ObjectPtr;
+
+    /**
+     * Three-way comparison result
+     * @note Unordered stands for values that are neither less, equal nor
+     * greater than each other, such as NaN
+     */
+    enum class Ordering : signed char
+    {
+        Less = -1,
+        Equal = 0,
+        Greater = 1,
+        Unordered = 2
+    };
+
     /**
      * Operators namespace
      */
@@ -86,6 +117,38 @@ namespace DynObjects
             std::false_type GreaterEqualsTest(...);
 
             template<class T> using GreaterEquals = decltype(GreaterEqualsTest(std::declval<T>()));
+
+
+            // Iterable check
+            template<class T, class = decltype(std::declval<const T&>().begin() != std::declval<const T&>().end())>
+            std::true_type  IterableTest(const T&);
+            std::false_type IterableTest(...);
+
+            template<class T> using Iterable = decltype(IterableTest(std::declval<T>()));
+
+
+            // Hashed container check
+            template<class T, class = typename T::hasher>
+            std::true_type  HashedTest(const T&);
+            std::false_type HashedTest(...);
+
+            template<class T> using Hashed = decltype(HashedTest(std::declval<T>()));
+
+
+            // Three-way compare method check
+            template<class T, class = decltype(std::declval<const T&>().compare(std::declval<const T&>()))>
+            std::true_type  CompareMethodTest(const T&);
+            std::false_type CompareMethodTest(...);
+
+            template<class T> using CompareMethod = decltype(CompareMethodTest(std::declval<T>()));
+
+
+            // Total compare method check
+            template<class T, class = decltype(std::declval<const T&>().TotalCompare(std::declval<const T&>()))>
+            std::true_type  TotalCompareMethodTest(const T&);
+            std::false_type TotalCompareMethodTest(...);
+
+            template<class T> using TotalCompareMethod = decltype(TotalCompareMethodTest(std::declval<T>()));
         }
 
         /**
@@ -94,200 +157,886 @@ namespace DynObjects
         namespace Impl
         {
             /**
-             * Implementation for comparator operator that throws an bad 
-             * function call in case the class has not the comparator implemented
+             * Three-way comparison strategies, in order of preference
+             */
+            enum CompareKind
+            {
+                InvalidCompare,
+                EqualityCompare,
+                OrderedCompare,
+                SequenceCompare,
+                ArrayCompare,
+                PairCompare,
+                MethodCompare,
+                ArithmeticCompare
+            };
+
+            template<typename _Tp>
+            struct CompareKindOf;
+
+            /**
+             * Whether a type is an ordered container of comparable items
+             */
+            template<typename _Tp, bool _Iterable = Checks::Iterable<_Tp>::value>
+            struct IsComparableSequence : public std::false_type
+            {
+            };
+
+            template<typename _Tp>
+            struct IsComparableSequence<_Tp, true> :
+            public std::integral_constant<bool, Checks::Less<_Tp>::value &&
+                CompareKindOf<typename std::remove_const<
+                typename _Tp::value_type>::type>::value != InvalidCompare>
+            {
+            };
+
+            /**
+             * Whether a type is a contiguous array of numbers handled by
+             * the vectorized kernels
              */
             template<typename _Tp>
-            class InvalidComparator
+            struct IsArithmeticArray : public std::false_type
+            {
+            };
+
+            template<typename _Tp, typename _Alloc>
+            struct IsArithmeticArray<std::vector<_Tp, _Alloc>> :
+            public std::integral_constant<bool, (std::is_integral<_Tp>::value &&
+                !std::is_same<_Tp, bool>::value) ||
+                std::is_same<_Tp, float>::value ||
+                std::is_same<_Tp, double>::value>
+            {
+            };
+
+            /**
+             * Whether a type is a pair of comparable items
+             */
+            template<typename _Tp>
+            struct IsComparablePair : public std::false_type
+            {
+            };
+
+            template<typename _T1, typename _T2>
+            struct IsComparablePair<std::pair<_T1, _T2>> :
+            public std::integral_constant<bool,
+                CompareKindOf<typename std::remove_const<_T1>::type>::value
+                != InvalidCompare &&
+                CompareKindOf<typename std::remove_const<_T2>::type>::value
+                != InvalidCompare>
+            {
+            };
+
+            /**
+             * Three-way comparison strategy of a type
+             */
+            template<typename _Tp>
+            struct CompareKindOf : public std::integral_constant<int,
+                std::is_arithmetic<_Tp>::value ? ArithmeticCompare :
+                Checks::CompareMethod<_Tp>::value ? MethodCompare :
+                IsComparablePair<_Tp>::value ? PairCompare :
+                IsArithmeticArray<_Tp>::value ? ArrayCompare :
+                IsComparableSequence<_Tp>::value ? SequenceCompare :
+                Checks::Less<_Tp>::value ? OrderedCompare :
+                Checks::Equals<_Tp>::value ? EqualityCompare : InvalidCompare>
+            {
+            };
+
+            /**
+             * Converts the result of a compare method into an ordering
+             * @param result Result of the compare method
+             * @return Ordering
+             */
+            inline Ordering ToOrdering(Ordering result)
+            {
+                return result;
+            }
+
+            template<typename _Result>
+            inline Ordering ToOrdering(_Result result)
+            {
+                return result < 0 ? Ordering::Less :
+                    (result > 0 ? Ordering::Greater : Ordering::Equal);
+            }
+
+            /**
+             * Implementation for types without comparison operators, throws
+             * a bad function call
+             */
+            template<typename _Tp, int _Kind>
+            class ThreeWay
             {
             public:
-                static inline bool Compare(const _Tp& a, const _Tp& b)
+                static inline Ordering Compare(const _Tp& a, const _Tp& b)
                 {
                     std::__throw_bad_function_call();
                 }
             };
 
             /**
-             * Valid implementation for less than operator
+             * Implementation for types with equalty operator only
              */
-            template<typename _Tp, bool _Valid = true>
-            class Equals
+            template<typename _Tp>
+            class ThreeWay<_Tp, EqualityCompare>
             {
             public:
-                static inline bool Compare(const _Tp& a, const _Tp& b)
+                static inline Ordering Compare(const _Tp& a, const _Tp& b)
                 {
-                    return a == b;
+                    return a == b ? Ordering::Equal : Ordering::Unordered;
                 }
             };
 
             /**
-             * Invalid implementation for less than operator
+             * Implementation for types with less than operator
              */
             template<typename _Tp>
-            class Equals<_Tp, false> : public InvalidComparator<_Tp>
+            class ThreeWay<_Tp, OrderedCompare>
             {
+            public:
+                static inline Ordering Compare(const _Tp& a, const _Tp& b)
+                {
+                    return a < b ? Ordering::Less :
+                        (b < a ? Ordering::Greater : Ordering::Equal);
+                }
             };
 
             /**
-             * Valid implementation for less than operator
+             * Implementation for ordered containers, compared in one pass
              */
-            template<typename _Tp, bool _Valid = true>
-            class NotEquals
+            template<typename _Tp>
+            class ThreeWay<_Tp, SequenceCompare>
             {
             public:
-                static inline bool Compare(const _Tp& a, const _Tp& b)
+                static inline Ordering Compare(const _Tp& a, const _Tp& b)
                 {
-                    return a != b;
+                    typedef typename std::remove_const<
+                        typename _Tp::value_type>::type _Item;
+
+                    auto itA = a.begin();
+                    auto itB = b.begin();
+
+                    for(; itA != a.end() && itB != b.end(); ++itA, ++itB)
+                    {
+                        Ordering result = ThreeWay<_Item,
+                            CompareKindOf<_Item>::value>::Compare(*itA, *itB);
+
+                        if(result != Ordering::Equal)
+                        {
+                            return result;
+                        }
+                    }
+
+                    return itA != a.end() ? Ordering::Greater :
+                        (itB != b.end() ? Ordering::Less : Ordering::Equal);
                 }
             };
 
             /**
-             * Invalid implementation for less than operator
+             * Implementation for arrays of numbers, the vectorized kernels
+             * find the first pair of items that are not equal
              */
             template<typename _Tp>
-            class NotEquals<_Tp, false> : public InvalidComparator<_Tp>
+            class ThreeWay<_Tp, ArrayCompare>
             {
+            public:
+                static inline Ordering Compare(const _Tp& a, const _Tp& b)
+                {
+                    typedef typename _Tp::value_type _Item;
+
+                    size_t size = a.size() < b.size() ? a.size() : b.size();
+                    size_t index = Kernels::Mismatch(a.data(), b.data(), size);
+
+                    if(index != size)
+                    {
+                        return ThreeWay<_Item, ArithmeticCompare>::Compare(
+                            a[index], b[index]);
+                    }
+
+                    return a.size() < b.size() ? Ordering::Less :
+                        (b.size() < a.size() ? Ordering::Greater :
+                        Ordering::Equal);
+                }
             };
 
             /**
-             * Valid implementation for less than operator
+             * Implementation for pairs
              */
-            template<typename _Tp, bool _Valid = true>
-            class Less
+            template<typename _Tp>
+            class ThreeWay<_Tp, PairCompare>
             {
             public:
-                static inline bool Compare(const _Tp& a, const _Tp& b)
+                static inline Ordering Compare(const _Tp& a, const _Tp& b)
                 {
-                    return a < b;
+                    typedef typename std::remove_const<
+                        typename _Tp::first_type>::type _First;
+                    typedef typename std::remove_const<
+                        typename _Tp::second_type>::type _Second;
+
+                    Ordering result = ThreeWay<_First,
+                        CompareKindOf<_First>::value>::Compare(a.first, b.first);
+
+                    return result != Ordering::Equal ? result : ThreeWay<_Second,
+                        CompareKindOf<_Second>::value>::Compare(a.second, b.second);
                 }
             };
 
             /**
-             * Invalid implementation for less than operator
+             * Implementation for types with a compare method
              */
             template<typename _Tp>
-            class Less<_Tp, false> : public InvalidComparator<_Tp>
+            class ThreeWay<_Tp, MethodCompare>
             {
+            public:
+                static inline Ordering Compare(const _Tp& a, const _Tp& b)
+                {
+                    return ToOrdering(a.compare(b));
+                }
             };
 
             /**
-             * Valid implementation for greater than operator
+             * Implementation for arithmetic types, NaN is unordered
              */
-            template<typename _Tp, bool _Valid = true>
-            class Greater
+            template<typename _Tp>
+            class ThreeWay<_Tp, ArithmeticCompare>
             {
             public:
-                static inline bool Compare(const _Tp& a, const _Tp& b)
+                static inline Ordering Compare(const _Tp& a, const _Tp& b)
                 {
-                    return a > b;
+                    return a < b ? Ordering::Less : (b < a ? Ordering::Greater :
+                        (a == b ? Ordering::Equal : Ordering::Unordered));
                 }
             };
 
+
             /**
-             * Invalid implementation for greater than operator
+             * Invalid hashing function
              */
             template<typename _Tp>
-            class Greater<_Tp, false> : public InvalidComparator<_Tp>
+            class InvalidHash
+            : public std::__hash_base<size_t, _Tp>
             {
+            public:
+                size_t operator()(const _Tp& __s) const noexcept
+                { 
+                    std::__throw_bad_function_call();
+                }
             };
 
+
             /**
-             * Valid implementation for greater than operator
+             * String hashing function
+             * @note Hashes the characters alone, so raw character sequences
+             * hash as the strings holding them
              */
-            template<typename _Tp, bool _Valid = true>
-            class LessEquals
+            template<typename _Tp>
+            class StringHash
             {
             public:
-                static inline bool Compare(const _Tp& a, const _Tp& b)
+                size_t operator()(const _Tp& __s) const noexcept
+                {
+                    return Hash(__s.data(), __s.size());
+                }
+
+                static size_t Hash(const typename _Tp::value_type *__s,
+                                   size_t __n) noexcept
                 {
-                    return a <= b;
+                    return Kernels::HashBytes(__s, __n * sizeof(*__s));
                 }
             };
 
+
+            /**
+             * Combines the hash of the next item into a running hash
+             * @param seed Running hash
+             * @param hash Hash of the next item
+             * @return Combined hash, depends on the order of the items
+             */
+            inline size_t HashCombine(size_t seed, size_t hash)
+            {
+                uint64_t combined = (static_cast<uint64_t>(seed) ^ hash) *
+                    0xc6a4a7935bd1e995ULL;
+                return static_cast<size_t>(combined ^ (combined >> 47));
+            }
+
+            /**
+             * Spreads the bits of an item hash before adding it to an
+             * order-independent sum
+             * @param hash Hash of an item
+             * @return Mixed hash
+             * @note Murmur3 finalizer, keeps sums of identity hashes from
+             * colliding
+             */
+            inline size_t HashMix(size_t hash)
+            {
+                uint64_t mixed = hash;
+                mixed ^= mixed >> 33;
+                mixed *= 0xff51afd7ed558ccdULL;
+                mixed ^= mixed >> 33;
+                mixed *= 0xc4ceb9fe1a85ec53ULL;
+                mixed ^= mixed >> 33;
+                return static_cast<size_t>(mixed);
+            }
+
+            /**
+             * Hashing strategies
+             */
+            enum HashKind
+            {
+                InvalidHashKind,
+                StandardHashKind,
+                PairHashKind,
+                SequenceHashKind,
+                UnorderedHashKind,
+                ArrayHashKind
+            };
+
+            template<typename _Tp>
+            struct HashKindOf;
+
+            template<typename _Tp>
+            struct HashOf;
+
+            /**
+             * Whether a type is a container of hashable items
+             */
+            template<typename _Tp, bool _Iterable = Checks::Iterable<_Tp>::value>
+            struct IsHashableContainer : public std::false_type
+            {
+            };
+
+            template<typename _Tp>
+            struct IsHashableContainer<_Tp, true> :
+            public std::integral_constant<bool, HashKindOf<typename
+                std::remove_const<typename _Tp::value_type>::type>::value !=
+                InvalidHashKind>
+            {
+            };
+
+            /**
+             * Whether a type is a pair of hashable items
+             */
+            template<typename _Tp>
+            struct IsHashablePair : public std::false_type
+            {
+            };
+
+            template<typename _T1, typename _T2>
+            struct IsHashablePair<std::pair<_T1, _T2>> :
+            public std::integral_constant<bool,
+                HashKindOf<typename std::remove_const<_T1>::type>::value !=
+                InvalidHashKind &&
+                HashKindOf<typename std::remove_const<_T2>::type>::value !=
+                InvalidHashKind>
+            {
+            };
+
+            /**
+             * Hashing strategy of a type
+             * @note Containers with a hasher are hashed regardless of the
+             * order of their items, as their equality operator compares
+             */
+            template<typename _Tp>
+            struct HashKindOf : public std::integral_constant<int,
+                std::is_constructible<std::hash<_Tp>>::value ?
+                StandardHashKind :
+                IsHashablePair<_Tp>::value ? PairHashKind :
+                !IsHashableContainer<_Tp>::value ? InvalidHashKind :
+                Checks::Hashed<_Tp>::value ? UnorderedHashKind :
+                IsArithmeticArray<_Tp>::value ? ArrayHashKind : SequenceHashKind>
+            {
+            };
+
+            /**
+             * Implementation for types without hashing function, throws a
+             * bad function call
+             */
+            template<typename _Tp, int _Kind>
+            class Hasher : public InvalidHash<_Tp>
+            {
+            };
+
             /**
-             * Invalid implementation for greater than operator
+             * Implementation for types with a standard hashing function
              */
             template<typename _Tp>
-            class LessEquals<_Tp, false> : public InvalidComparator<_Tp>
+            class Hasher<_Tp, StandardHashKind> : public std::hash<_Tp>
             {
             };
 
             /**
-             * Valid implementation for greater than operator
+             * Implementation for pairs
              */
-            template<typename _Tp, bool _Valid = true>
-            class GreaterEquals
+            template<typename _Tp>
+            class Hasher<_Tp, PairHashKind>
             {
             public:
-                static inline bool Compare(const _Tp& a, const _Tp& b)
+                size_t operator()(const _Tp& __s) const
                 {
-                    return a >= b;
+                    typedef typename std::remove_const<
+                        typename _Tp::first_type>::type _First;
+                    typedef typename std::remove_const<
+                        typename _Tp::second_type>::type _Second;
+
+                    return HashCombine(
+                        typename HashOf<_First>::type()(__s.first),
+                        typename HashOf<_Second>::type()(__s.second));
                 }
             };
 
             /**
-             * Invalid implementation for greater than operator
+             * Implementation for ordered containers, hashed in one pass
              */
             template<typename _Tp>
-            class GreaterEquals<_Tp, false> : public InvalidComparator<_Tp>
+            class Hasher<_Tp, SequenceHashKind>
             {
+            public:
+                size_t operator()(const _Tp& __s) const
+                {
+                    typedef typename std::remove_const<
+                        typename _Tp::value_type>::type _Item;
+
+                    typename HashOf<_Item>::type hasher;
+                    size_t hash = 0;
+                    size_t size = 0;
+
+                    for(const auto &item : __s)
+                    {
+                        hash = HashCombine(hash, hasher(item));
+                        ++size;
+                    }
+
+                    return HashCombine(hash, size);
+                }
             };
 
+            /**
+             * Implementation for hashed containers, the sum of the mixed
+             * hashes of their items does not depend on their order
+             */
+            template<typename _Tp>
+            class Hasher<_Tp, UnorderedHashKind>
+            {
+            public:
+                size_t operator()(const _Tp& __s) const
+                {
+                    typedef typename std::remove_const<
+                        typename _Tp::value_type>::type _Item;
+
+                    typename HashOf<_Item>::type hasher;
+                    size_t hash = 0;
+                    size_t size = 0;
+
+                    for(const auto &item : __s)
+                    {
+                        hash += HashMix(hasher(item));
+                        ++size;
+                    }
+
+                    return HashCombine(hash, size);
+                }
+            };
 
             /**
-             * Invalid hashing function
+             * Implementation for arrays of numbers, hashed by the
+             * vectorized kernels
              */
             template<typename _Tp>
-            class InvalidHash
-            : public std::__hash_base<size_t, _Tp>
+            class Hasher<_Tp, ArrayHashKind>
             {
             public:
                 size_t operator()(const _Tp& __s) const noexcept
-                { 
-                    std::__throw_bad_function_call();
+                {
+                    return Hash(__s.data(), __s.size());
+                }
+
+                // Equal arrays of integers have equal bytes
+                template<typename _Item>
+                static size_t Hash(const _Item *__s, size_t __n) noexcept
+                {
+                    return Kernels::HashBytes(__s, __n * sizeof(_Item));
+                }
+
+                static size_t Hash(const float *__s, size_t __n) noexcept
+                {
+                    return Kernels::HashFloats(__s, __n);
+                }
+
+                static size_t Hash(const double *__s, size_t __n) noexcept
+                {
+                    return Kernels::HashDoubles(__s, __n);
+                }
+            };
+
+            /**
+             * Hashing function selection
+             */
+            template<typename _Tp>
+            struct HashOf
+            {
+                typedef Hasher<_Tp, HashKindOf<_Tp>::value> type;
+            };
+
+            template<typename _CharT, typename _Traits, typename _Alloc>
+            struct HashOf<std::basic_string<_CharT, _Traits, _Alloc>>
+            {
+                typedef StringHash<std::basic_string<_CharT, _Traits,
+                    _Alloc>> type;
+            };
+
+
+            /**
+             * Orders two values by hash, the last resort of the total order
+             * @param a Hash of the first value
+             * @param b Hash of the second value
+             * @return Ordering of the hashes
+             */
+            inline Ordering HashOrdering(size_t a, size_t b)
+            {
+                return a < b ? Ordering::Less :
+                    (b < a ? Ordering::Greater : Ordering::Equal);
+            }
+
+            /**
+             * Three-way comparison falling back to the order of the hashes
+             * of unordered values, values of equal hash being equivalent
+             * @param a First value
+             * @param b Second value
+             * @return Ordering of a relative to b, never unordered
+             */
+            template<typename _Tp, int _Kind>
+            inline Ordering CompareOrHash(const _Tp& a, const _Tp& b)
+            {
+                Ordering result = ThreeWay<_Tp, _Kind>::Compare(a, b);
+
+                if(result != Ordering::Unordered)
+                {
+                    return result;
+                }
+
+                typename HashOf<_Tp>::type hasher;
+                return HashOrdering(hasher(a), hasher(b));
+            }
+
+            /**
+             * Total order, agrees with the three-way comparison wherever it
+             * is not unordered. Unordered values without a better rule are
+             * ordered by hash (see CompareOrHash)
+             */
+            template<typename _Tp, int _Kind>
+            class TotalOrder
+            {
+            public:
+                static inline Ordering Compare(const _Tp& a, const _Tp& b)
+                {
+                    return CompareOrHash<_Tp, _Kind>(a, b);
+                }
+            };
+
+            /**
+             * Implementation for containers with equalty operator only,
+             * ordered by size and then by their items in sorted order
+             */
+            template<typename _Tp>
+            class TotalOrder<_Tp, EqualityCompare>
+            {
+            public:
+                static inline Ordering Compare(const _Tp& a, const _Tp& b)
+                {
+                    return Compare(a, b, Checks::Iterable<_Tp>());
+                }
+
+            private:
+                static inline Ordering Compare(const _Tp& a, const _Tp& b,
+                                               std::false_type)
+                {
+                    return CompareOrHash<_Tp, EqualityCompare>(a, b);
+                }
+
+                static inline Ordering Compare(const _Tp& a, const _Tp& b,
+                                               std::true_type)
+                {
+                    typedef typename std::remove_const<
+                        typename _Tp::value_type>::type _Item;
+                    typedef TotalOrder<_Item, CompareKindOf<_Item>::value>
+                        _Order;
+
+                    if(a == b)
+                    {
+                        return Ordering::Equal;
+                    }
+
+                    std::vector<const _Item *> itemsA;
+                    std::vector<const _Item *> itemsB;
+
+                    for(const auto &item : a)
+                    {
+                        itemsA.push_back(&item);
+                    }
+
+                    for(const auto &item : b)
+                    {
+                        itemsB.push_back(&item);
+                    }
+
+                    if(itemsA.size() != itemsB.size())
+                    {
+                        return itemsA.size() < itemsB.size() ?
+                            Ordering::Less : Ordering::Greater;
+                    }
+
+                    auto less = [](const _Item *x, const _Item *y)
+                    {
+                        return _Order::Compare(*x, *y) == Ordering::Less;
+                    };
+
+                    std::sort(itemsA.begin(), itemsA.end(), less);
+                    std::sort(itemsB.begin(), itemsB.end(), less);
+
+                    for(size_t i = 0; i < itemsA.size(); ++i)
+                    {
+                        Ordering result = _Order::Compare(*itemsA[i],
+                            *itemsB[i]);
+
+                        if(result != Ordering::Equal)
+                        {
+                            return result;
+                        }
+                    }
+
+                    return Ordering::Equal;
+                }
+            };
+
+            /**
+             * Implementation for ordered containers
+             */
+            template<typename _Tp>
+            class TotalOrder<_Tp, SequenceCompare>
+            {
+            public:
+                static inline Ordering Compare(const _Tp& a, const _Tp& b)
+                {
+                    typedef typename std::remove_const<
+                        typename _Tp::value_type>::type _Item;
+
+                    auto itA = a.begin();
+                    auto itB = b.begin();
+
+                    for(; itA != a.end() && itB != b.end(); ++itA, ++itB)
+                    {
+                        Ordering result = TotalOrder<_Item,
+                            CompareKindOf<_Item>::value>::Compare(*itA, *itB);
+
+                        if(result != Ordering::Equal)
+                        {
+                            return result;
+                        }
+                    }
+
+                    return itA != a.end() ? Ordering::Greater :
+                        (itB != b.end() ? Ordering::Less : Ordering::Equal);
+                }
+            };
+
+            /**
+             * Implementation for arrays of numbers, NaN items found by the
+             * kernels are equal to each other
+             */
+            template<typename _Tp>
+            class TotalOrder<_Tp, ArrayCompare>
+            {
+            public:
+                static inline Ordering Compare(const _Tp& a, const _Tp& b)
+                {
+                    typedef typename _Tp::value_type _Item;
+
+                    size_t size = a.size() < b.size() ? a.size() : b.size();
+
+                    for(size_t start = 0; start < size; ++start)
+                    {
+                        start += Kernels::Mismatch(a.data() + start,
+                            b.data() + start, size - start);
+
+                        if(start == size)
+                        {
+                            break;
+                        }
+
+                        Ordering result = TotalOrder<_Item,
+                            ArithmeticCompare>::Compare(a[start], b[start]);
+
+                        if(result != Ordering::Equal)
+                        {
+                            return result;
+                        }
+                    }
+
+                    return a.size() < b.size() ? Ordering::Less :
+                        (b.size() < a.size() ? Ordering::Greater :
+                        Ordering::Equal);
+                }
+            };
+
+            /**
+             * Implementation for pairs
+             */
+            template<typename _Tp>
+            class TotalOrder<_Tp, PairCompare>
+            {
+            public:
+                static inline Ordering Compare(const _Tp& a, const _Tp& b)
+                {
+                    typedef typename std::remove_const<
+                        typename _Tp::first_type>::type _First;
+                    typedef typename std::remove_const<
+                        typename _Tp::second_type>::type _Second;
+
+                    Ordering result = TotalOrder<_First,
+                        CompareKindOf<_First>::value>::Compare(a.first, b.first);
+
+                    return result != Ordering::Equal ? result : TotalOrder<
+                        _Second, CompareKindOf<_Second>::value>::Compare(
+                        a.second, b.second);
+                }
+            };
+
+            /**
+             * Implementation for types with a compare method, their total
+             * compare method is used if they have one
+             */
+            template<typename _Tp>
+            class TotalOrder<_Tp, MethodCompare>
+            {
+            public:
+                static inline Ordering Compare(const _Tp& a, const _Tp& b)
+                {
+                    return Compare(a, b, Checks::TotalCompareMethod<_Tp>());
+                }
+
+            private:
+                static inline Ordering Compare(const _Tp& a, const _Tp& b,
+                                               std::true_type)
+                {
+                    return ToOrdering(a.TotalCompare(b));
+                }
+
+                static inline Ordering Compare(const _Tp& a, const _Tp& b,
+                                               std::false_type)
+                {
+                    return CompareOrHash<_Tp, MethodCompare>(a, b);
+                }
+            };
+
+            /**
+             * Implementation for arithmetic types, NaN is greater than any
+             * number and equal to any other NaN
+             */
+            template<typename _Tp>
+            class TotalOrder<_Tp, ArithmeticCompare>
+            {
+            public:
+                static inline Ordering Compare(const _Tp& a, const _Tp& b)
+                {
+                    if(a < b)
+                    {
+                        return Ordering::Less;
+                    }
+
+                    if(b < a)
+                    {
+                        return Ordering::Greater;
+                    }
+
+                    bool nanA = std::isnan(a);
+                    bool nanB = std::isnan(b);
+
+                    return nanA == nanB ? Ordering::Equal :
+                        (nanA ? Ordering::Greater : Ordering::Less);
                 }
             };
         }
 
         /// Comparators types
 
-        // Equalty comparator
+        // Three-way comparator
         template<typename _Tp>
-        class Equals : public Impl::Equals<_Tp, 
-                Checks::Equals<_Tp>::value> {};
+        class ThreeWay : public Impl::ThreeWay<_Tp,
+                Impl::CompareKindOf<_Tp>::value> {};
 
-        // Non-equalty comparator
+        // Total order comparator
         template<typename _Tp>
-        class NotEquals : public Impl::NotEquals<_Tp, 
-                    Checks::NotEquals<_Tp>::value> {};
+        class TotalOrder : public Impl::TotalOrder<_Tp,
+                Impl::CompareKindOf<_Tp>::value> {};
 
-        // Less comparator
-        template<typename _Tp>
-        class Less : public Impl::Less<_Tp,
-                Checks::Less<_Tp>::value> {};
 
-        // Greater comparator
-        template<typename _Tp>
-        class Greater : public Impl::Greater<_Tp, 
-                    Checks::Greater<_Tp>::value> {};
+        /// Traversal types
+
+        /**
+         * Object pointers visitor function
+         */
+        typedef void (*ObjectVisitor)(const ObjectPtr &, void *);
+
+        // Object pointers traversal, visits every pointer held by an item
+        template<typename _Tp, typename = void>
+        class ForEachObject
+        {
+        public:
+            static inline void Visit(const _Tp &, ObjectVisitor, void *)
+            {
+            }
+        };
 
-        // Less or equals comparator
+        // Traversal of object pointers
         template<typename _Tp>
-        class LessEquals : public Impl::LessEquals<_Tp, 
-                    Checks::LessEquals<_Tp>::value> {};
+        class ForEachObject<_Tp, typename std::enable_if<
+            std::is_base_of<ObjectPtr, _Tp>::value>::type>
+        {
+        public:
+            static inline void Visit(const _Tp &item, ObjectVisitor visitor,
+                                     void *context)
+            {
+                visitor(item, context);
+            }
+        };
+
+        // Traversal of pairs
+        template<typename _T1, typename _T2>
+        class ForEachObject<std::pair<_T1, _T2>, void>
+        {
+        public:
+            static inline void Visit(const std::pair<_T1, _T2> &item,
+                                     ObjectVisitor visitor, void *context)
+            {
+                ForEachObject<typename std::remove_const<_T1>::type>::Visit(
+                    item.first, visitor, context);
+                ForEachObject<_T2>::Visit(item.second, visitor, context);
+            }
+        };
 
-        // Greater or equals comparator
+        // Traversal of containers, skipped for containers of scalars
         template<typename _Tp>
-        class GreaterEquals : public Impl::GreaterEquals<_Tp, 
-                        Checks::GreaterEquals<_Tp>::value> {};
+        class ForEachObject<_Tp, typename std::enable_if<
+            !std::is_base_of<ObjectPtr, _Tp>::value &&
+            Checks::Iterable<_Tp>::value && !std::is_arithmetic<
+            typename _Tp::value_type>::value>::type>
+        {
+        public:
+            static inline void Visit(const _Tp &item, ObjectVisitor visitor,
+                                     void *context)
+            {
+                for(const auto &element : item)
+                {
+                    ForEachObject<typename _Tp::value_type>::Visit(
+                        element, visitor, context);
+                }
+            }
+        };
 
 
         /// Misc functions
 
         // Hash operator
         template<typename _Tp>
-        using Hash = typename std::conditional<std::is_constructible<
-        std::hash<_Tp>>::value, std::hash<_Tp>, Impl::InvalidHash<_Tp>>::type;
+        using Hash = typename Impl::HashOf<_Tp>::type;
     }
 }
 
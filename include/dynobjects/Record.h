@@ -0,0 +1,409 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   Record.h
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 20:45
+ */
+
+#ifndef DYNOBJECTS_RECORD_H
+#define DYNOBJECTS_RECORD_H
+
+/// Internal libs includes
+#include "Allocator.h"
+#include "Instance.h"
+#include "Object.h"
+#include "Shape.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+/**
+ * DynObjects library namespace
+ */
+namespace DynObjects
+{
+    /**
+     * Record object, a set of named fields
+     * @note Field names live in the shape (see Shape) shared by every record
+     * with the same fields, the record only holds the field values, by
+     * index. Records with the same fields are equal whatever the order the
+     * fields were added in. Records adding fields to a shape that can not
+     * have more children get a shape of their own (see Shape::Derive),
+     * shared by their copies only
+     */
+    class Record : public Object
+    {
+    public:
+        /// Types definitions
+
+        typedef std::vector<ObjectPtr, PoolAllocator<ObjectPtr>>
+            container_type;
+
+        /// Class constructors
+
+        /**
+         * Class default constructor, a record without fields
+         */
+        Record() : Object(GetTypeId<Record>()), m_Shape(&Shape::GetRoot())
+        {
+        }
+
+        /**
+         * Class constructor
+         * @param shape Record shape, it must outlive the record if it is
+         * not shared (see Shape::IsShared)
+         * @param values Field values, by index
+         * @throw std::invalid_argument If there is not a value per field
+         */
+        Record(const Shape &shape, const std::vector<ObjectPtr> &values) :
+        Object(GetTypeId<Record>()), m_Shape(&shape),
+        m_Fields(values.begin(), values.end())
+        {
+            if(values.size() != shape.GetSize())
+            {
+                throw std::invalid_argument("Record needs a value per field");
+            }
+        }
+
+        /**
+         * Class copy constructor
+         * @param o Object to copy
+         */
+        Record(const Record &o) = default;
+
+        /**
+         * Class move constructor
+         * @param o Object to move
+         * @note The moved record is left without fields
+         */
+        Record(Record &&o) : Object(o), m_Shape(o.m_Shape),
+        m_Owned(std::move(o.m_Owned)), m_Fields(std::move(o.m_Fields))
+        {
+            o.m_Shape = &Shape::GetRoot();
+            o.m_Owned.reset();
+            o.m_Fields.clear();
+        }
+
+        /**
+         * Class destructor
+         */
+        virtual ~Record()
+        {
+        }
+
+        /// Class operators
+
+        /**
+         * De-reference operator
+         * @return A reference to itself
+         */
+        inline Record &operator*()
+        {
+            return *this;
+        }
+
+        /**
+         * De-reference operator
+         * @return A const reference to itself
+         */
+        inline const Record &operator*() const
+        {
+            return *this;
+        }
+
+        /**
+         * Copy assignation operator
+         * @param o Object to be assigned
+         * @return A reference to itself
+         */
+        Record &operator=(const Record &o) = default;
+
+        /**
+         * Move assignation operator
+         * @param o Object to be moved
+         * @return A reference to itself
+         */
+        Record &operator=(Record &&o)
+        {
+            Object::operator=(o);
+            this->m_Shape = o.m_Shape;
+            this->m_Owned = std::move(o.m_Owned);
+            this->m_Fields = std::move(o.m_Fields);
+
+            o.m_Shape = &Shape::GetRoot();
+            o.m_Owned.reset();
+            o.m_Fields.clear();
+            return *this;
+        }
+
+        using Object::operator!=;
+        using Object::operator==;
+        using Object::operator<;
+        using Object::operator>;
+        using Object::operator<=;
+        using Object::operator>=;
+
+        /// Class implementations
+
+        /**
+         * Three-way comparison method
+         * @param o Object to compare
+         * @return Ordering of the object relative to o
+         * @note Records are ordered as their (name, value) pairs sorted by
+         * name
+         */
+        virtual Ordering compare(const Object &o) const;
+
+        /**
+         * Total order method, as compare with the fields ordered by their
+         * total order
+         * @param o Object to compare
+         * @return Ordering of the object relative to o, never unordered
+         */
+        virtual Ordering TotalCompare(const Object &o) const;
+
+        virtual std::string GetObjectType() const
+        {
+            return GetTypeInfo<Record>().GetName();
+        }
+
+        /**
+         * Hashing method
+         * @return Hash of the object
+         */
+        virtual size_t hash() const;
+
+        /**
+         * Visits the field values
+         * @param visitor Function called with each field value
+         * @param context Opaque context passed to the visitor
+         */
+        virtual void ForEachChild(Operators::ObjectVisitor visitor,
+                                  void *context) const;
+
+        /**
+         * Returns the record shape
+         * @return Shape
+         */
+        inline const Shape &GetShape() const
+        {
+            return *this->m_Shape;
+        }
+
+        /**
+         * Returns the number of fields
+         * @return Number of fields
+         */
+        inline size_t GetSize() const
+        {
+            return this->m_Fields.size();
+        }
+
+        /**
+         * Returns whether or not the record has a field
+         * @param key Field name
+         * @return Whether or not the field exists
+         */
+        inline bool Has(const std::string &key) const
+        {
+            return this->m_Shape->FindField(key) != Shape::NoField;
+        }
+
+        inline bool Has(const FieldKey &key) const
+        {
+            return key.Find(*this->m_Shape) != Shape::NoField;
+        }
+
+        /**
+         * Returns the value of a field
+         * @param key Field name
+         * @return A reference to the field value
+         * @throw std::out_of_range If the record has no such field
+         */
+        inline ObjectPtr &Get(const std::string &key)
+        {
+            return this->GetField(this->Check(this->m_Shape->FindField(key)));
+        }
+
+        inline const ObjectPtr &Get(const std::string &key) const
+        {
+            return this->GetField(this->Check(this->m_Shape->FindField(key)));
+        }
+
+        inline ObjectPtr &Get(const FieldKey &key)
+        {
+            return this->GetField(this->Check(key.Find(*this->m_Shape)));
+        }
+
+        inline const ObjectPtr &Get(const FieldKey &key) const
+        {
+            return this->GetField(this->Check(key.Find(*this->m_Shape)));
+        }
+
+        /**
+         * Sets the value of a field, adding it if the record does not have
+         * it yet
+         * @param key Field name
+         * @param value Field value
+         */
+        inline void Set(const std::string &key, ObjectPtr value)
+        {
+            this->SetField(this->m_Shape->FindField(key), key,
+                           std::move(value));
+        }
+
+        inline void Set(const FieldKey &key, ObjectPtr value)
+        {
+            this->SetField(key.Find(*this->m_Shape), key.GetName(),
+                           std::move(value));
+        }
+
+        /**
+         * Returns the value of a field by index
+         * @param index Field index in the shape, not checked
+         * @return A reference to the field value
+         */
+        inline ObjectPtr &GetField(size_t index)
+        {
+            return this->m_Fields[index];
+        }
+
+        inline const ObjectPtr &GetField(size_t index) const
+        {
+            return this->m_Fields[index];
+        }
+
+    private:
+        /// Class helpers
+
+        /**
+         * Compares the record with an object
+         * @param o Object to compare
+         * @param total Whether to compare the fields by their total order
+         * @return Ordering of the object relative to o
+         */
+        Ordering Compare(const Object &o, bool total) const;
+
+        /**
+         * Checks a field index
+         * @param index Field index, or Shape::NoField
+         * @return The same index
+         * @throw std::out_of_range If the field is missing
+         */
+        static inline size_t Check(size_t index)
+        {
+            if(index == Shape::NoField)
+            {
+                throw std::out_of_range("Record has no such field");
+            }
+
+            return index;
+        }
+
+        /**
+         * Sets the value of a field, adding it if it is missing
+         * @param index Field index, or Shape::NoField
+         * @param key Field name
+         * @param value Field value
+         */
+        inline void SetField(size_t index, const std::string &key,
+                             ObjectPtr &&value)
+        {
+            if(index != Shape::NoField)
+            {
+                this->m_Fields[index] = std::move(value);
+                return;
+            }
+
+            const Shape *shape = this->m_Shape->TryAddField(key);
+
+            if(shape == nullptr)
+            {
+                this->m_Shape = this->AddOwnedField(key);
+                this->m_Fields.push_back(std::move(value));
+                return;
+            }
+
+            // Size the storage once for the fields records like this get
+            if(this->m_Fields.size() == this->m_Fields.capacity())
+            {
+                size_t hint = shape->GetCapacityHint();
+                this->m_Fields.reserve(hint > this->m_Fields.size() ?
+                    hint : this->m_Fields.size() + 1);
+            }
+
+            this->m_Fields.push_back(std::move(value));
+            this->m_Shape = shape;
+        }
+
+        /**
+         * Adds a field to the shape of its own of the record, building it
+         * if needed
+         * @param key Field name
+         * @return Shape of its own with the field
+         */
+        inline const Shape *AddOwnedField(const std::string &key)
+        {
+            // Copies of the record keep the shape they have
+            if(this->m_Owned && this->m_Owned.use_count() == 1)
+            {
+                this->m_Owned->Append(key);
+            }
+            else
+            {
+                this->m_Owned = this->m_Shape->Derive(key);
+            }
+
+            return this->m_Owned.get();
+        }
+
+        /// Class attributes
+
+        /**
+         * Record shape
+         */
+        const Shape *m_Shape;
+
+        /**
+         * Record shape if it is a shape of its own, null otherwise
+         */
+        std::shared_ptr<Shape> m_Owned;
+
+        /**
+         * Field values, by index in the shape
+         */
+        container_type m_Fields;
+    };
+
+    /**
+     * Record instances alias
+     */
+    typedef Instance<Record, Record> RecordInstance;
+}
+
+#endif /* DYNOBJECTS_RECORD_H */
+
@@ -0,0 +1,766 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   ScalarValue.h
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 23:55
+ */
+
+#ifndef DYNOBJECTS_SCALAR_VALUE_H
+#define DYNOBJECTS_SCALAR_VALUE_H
+
+/// Internal libs includes
+#include "Atom.h"
+#include "Object.h"
+#include "Operators.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+
+
+/**
+ * DynObjects library namespace
+ */
+namespace DynObjects
+{
+    /**
+     * Kind of the values holding an item type, see ScalarValue
+     */
+    template<typename T>
+    struct ScalarKindOf;
+
+    /**
+     * Closed-world scalar value, a tagged union of the items of the basic
+     * types aliases (see BasicTypes.h) and of String
+     * @note Values are trivially copyable literal types of 24 bytes, built
+     * without allocating and handled without virtual calls. Strings of up
+     * to MaxStringSize characters are stored inline, keep longer text as
+     * String objects (see TryFromObject). Symbols are held as they are, so only names the
+     * caller interned explicitly are ever interned. Values order, compare
+     * and hash as the objects they box (see ToObject)
+     */
+    class ScalarValue
+    {
+    public:
+        /**
+         * Value kinds, one per item type
+         */
+        enum class Kind : uint8_t
+        {
+            Null,
+            Boolean,
+            Char,
+            SChar,
+            UChar,
+            Short,
+            UShort,
+            Int,
+            UInt,
+            Long,
+            ULong,
+            LongLong,
+            ULongLong,
+            Float,
+            Double,
+            String,
+            Symbol
+        };
+
+        /**
+         * Maximum number of characters of inline strings
+         */
+        static const size_t MaxStringSize = 15;
+
+        /**
+         * Inline string, the item of string values
+         */
+        struct ShortString
+        {
+            /**
+             * String characters, not null-terminated
+             */
+            char Data[MaxStringSize];
+
+            /**
+             * Number of characters
+             */
+            uint8_t Size;
+
+            /**
+             * Three-way comparison method
+             * @param o String to compare with
+             * @return Negative, zero or positive as the string is less,
+             * equal or greater than o, as std::string does
+             */
+            inline int compare(const ShortString &o) const
+            {
+                int result = std::char_traits<char>::compare(this->Data,
+                    o.Data, this->Size < o.Size ? this->Size : o.Size);
+                return result != 0 ? result : int(this->Size) - int(o.Size);
+            }
+
+            /**
+             * Returns the string
+             * @return A copy of the characters
+             */
+            inline std::string ToString() const
+            {
+                return std::string(this->Data, this->Size);
+            }
+        };
+
+        /// Class constructors
+
+        /**
+         * Class default constructor, the null value
+         */
+        constexpr ScalarValue() : m_Kind(Kind::Null), m_Item()
+        {
+        }
+
+        constexpr ScalarValue(std::nullptr_t) : m_Kind(Kind::Null), m_Item()
+        {
+        }
+
+        /**
+         * Class constructor with an item
+         * @param value Item
+         */
+        constexpr ScalarValue(bool value) :
+        m_Kind(Kind::Boolean), m_Item(value)
+        {
+        }
+
+        constexpr ScalarValue(char value) : m_Kind(Kind::Char), m_Item(value)
+        {
+        }
+
+        constexpr ScalarValue(signed char value) :
+        m_Kind(Kind::SChar), m_Item(value)
+        {
+        }
+
+        constexpr ScalarValue(unsigned char value) :
+        m_Kind(Kind::UChar), m_Item(value)
+        {
+        }
+
+        constexpr ScalarValue(short value) :
+        m_Kind(Kind::Short), m_Item(value)
+        {
+        }
+
+        constexpr ScalarValue(unsigned short value) :
+        m_Kind(Kind::UShort), m_Item(value)
+        {
+        }
+
+        constexpr ScalarValue(int value) : m_Kind(Kind::Int), m_Item(value)
+        {
+        }
+
+        constexpr ScalarValue(unsigned int value) :
+        m_Kind(Kind::UInt), m_Item(value)
+        {
+        }
+
+        constexpr ScalarValue(long value) : m_Kind(Kind::Long), m_Item(value)
+        {
+        }
+
+        constexpr ScalarValue(unsigned long value) :
+        m_Kind(Kind::ULong), m_Item(value)
+        {
+        }
+
+        constexpr ScalarValue(long long value) :
+        m_Kind(Kind::LongLong), m_Item(value)
+        {
+        }
+
+        constexpr ScalarValue(unsigned long long value) :
+        m_Kind(Kind::ULongLong), m_Item(value)
+        {
+        }
+
+        constexpr ScalarValue(float value) :
+        m_Kind(Kind::Float), m_Item(value)
+        {
+        }
+
+        constexpr ScalarValue(double value) :
+        m_Kind(Kind::Double), m_Item(value)
+        {
+        }
+
+        constexpr ScalarValue(Symbol value) :
+        m_Kind(Kind::Symbol), m_Item(value)
+        {
+        }
+
+        /**
+         * Class constructor with a string, copied inline
+         * @param value String
+         * @throw std::length_error If the string is longer than
+         * MaxStringSize characters
+         * @note Explicit, as most strings are too long to convert
+         */
+        explicit ScalarValue(const std::string &value) :
+        m_Kind(Kind::String), m_Item()
+        {
+            this->Assign(value.data(), value.size());
+        }
+
+        explicit ScalarValue(const char *value) :
+        m_Kind(Kind::String), m_Item()
+        {
+            this->Assign(value, std::char_traits<char>::length(value));
+        }
+
+        /**
+         * Prevents pointers, such as strings outside of a direct
+         * initialization, from converting to boolean values
+         */
+        template<typename T>
+        ScalarValue(const T *) = delete;
+
+        ScalarValue(const char *value, size_t size) :
+        m_Kind(Kind::String), m_Item()
+        {
+            this->Assign(value, size);
+        }
+
+        /**
+         * Class constructor with an object pointer
+         * @param ptr Object pointer, null for the null value
+         * @throw std::bad_cast If the object is not of a basic type alias,
+         * a String or an Atom
+         * @throw std::length_error If the object is a String longer than
+         * MaxStringSize characters
+         * @note Use TryFromObject to keep the objects that are not scalar
+         * values as they are
+         */
+        explicit ScalarValue(const ObjectPtr &ptr);
+
+        /// Class operators
+
+        inline bool operator==(const ScalarValue &o) const
+        {
+            return this->compare(o) == Ordering::Equal;
+        }
+
+        inline bool operator!=(const ScalarValue &o) const
+        {
+            return this->compare(o) != Ordering::Equal;
+        }
+
+        inline bool operator<(const ScalarValue &o) const
+        {
+            return this->compare(o) == Ordering::Less;
+        }
+
+        inline bool operator>(const ScalarValue &o) const
+        {
+            return this->compare(o) == Ordering::Greater;
+        }
+
+        inline bool operator<=(const ScalarValue &o) const
+        {
+            Ordering result = this->compare(o);
+            return result == Ordering::Less || result == Ordering::Equal;
+        }
+
+        inline bool operator>=(const ScalarValue &o) const
+        {
+            Ordering result = this->compare(o);
+            return result == Ordering::Greater || result == Ordering::Equal;
+        }
+
+        /// Class implementations
+
+        /**
+         * Returns the value kind
+         * @return Value kind
+         */
+        constexpr Kind GetKind() const
+        {
+            return this->m_Kind;
+        }
+
+        constexpr bool IsNull() const
+        {
+            return this->m_Kind == Kind::Null;
+        }
+
+        constexpr bool IsString() const
+        {
+            return this->m_Kind == Kind::String;
+        }
+
+        /**
+         * Returns whether or not the value holds an item of a type
+         * @return Whether or not the item is a T
+         */
+        template<typename T>
+        constexpr bool Is() const
+        {
+            return this->m_Kind == ScalarKindOf<T>::value;
+        }
+
+        /**
+         * Returns the item
+         * @return A const reference to the item
+         * @throw std::bad_cast If the item is not a T
+         */
+        template<typename T>
+        inline const T &Get() const
+        {
+            if(!this->Is<T>())
+            {
+                throw std::bad_cast();
+            }
+
+            return this->Ref<T>();
+        }
+
+        /**
+         * Returns the string
+         * @return A copy of the string
+         * @throw std::bad_cast If the value is not a string
+         */
+        inline std::string GetString() const
+        {
+            if(!this->IsString())
+            {
+                throw std::bad_cast();
+            }
+
+            return this->m_Item.String.ToString();
+        }
+
+        /**
+         * Calls a visitor with the item
+         * @param visitor Function object taking every item type, and
+         * std::nullptr_t for the null value
+         * @return Result of the visitor
+         * @note A switch on the kind, the visitor is not type-erased
+         */
+        template<typename _Visitor>
+        inline auto Apply(_Visitor &&visitor) const -> decltype(visitor(0))
+        {
+            switch(this->m_Kind)
+            {
+            case Kind::Boolean:
+                return visitor(this->m_Item.Boolean);
+            case Kind::Char:
+                return visitor(this->m_Item.Char);
+            case Kind::SChar:
+                return visitor(this->m_Item.SChar);
+            case Kind::UChar:
+                return visitor(this->m_Item.UChar);
+            case Kind::Short:
+                return visitor(this->m_Item.Short);
+            case Kind::UShort:
+                return visitor(this->m_Item.UShort);
+            case Kind::Int:
+                return visitor(this->m_Item.Int);
+            case Kind::UInt:
+                return visitor(this->m_Item.UInt);
+            case Kind::Long:
+                return visitor(this->m_Item.Long);
+            case Kind::ULong:
+                return visitor(this->m_Item.ULong);
+            case Kind::LongLong:
+                return visitor(this->m_Item.LongLong);
+            case Kind::ULongLong:
+                return visitor(this->m_Item.ULongLong);
+            case Kind::Float:
+                return visitor(this->m_Item.Float);
+            case Kind::Double:
+                return visitor(this->m_Item.Double);
+            case Kind::String:
+                return visitor(this->m_Item.String);
+            case Kind::Symbol:
+                return visitor(this->m_Item.Interned);
+            default:
+                return visitor(nullptr);
+            }
+        }
+
+        /**
+         * Returns the value as an object pointer
+         * @return Object pointer, a new Basic object, String or Atom, or the
+         * null pointer for the null value
+         */
+        ObjectPtr ToObject() const;
+
+        /**
+         * Builds a value from an object pointer, if it holds a scalar value
+         * @param ptr Object pointer, null for the null value
+         * @param value Value built, untouched on failure
+         * @return Whether or not the object is of a basic type alias, an
+         * Atom or a String of up to MaxStringSize characters
+         */
+        static bool TryFromObject(const ObjectPtr &ptr, ScalarValue &value);
+
+        /**
+         * Three-way comparison method
+         * @param o Value to compare with
+         * @return Ordering of the value relative to o
+         */
+        inline Ordering compare(const ScalarValue &o) const
+        {
+            if(this->m_Kind == o.m_Kind)
+            {
+                return this->Apply(Comparator{o});
+            }
+
+            return this->CompareKind(o);
+        }
+
+        /**
+         * Hashing method
+         * @return Hash of the value, the one of the boxed object
+         */
+        inline size_t hash() const
+        {
+            return this->Apply(Hasher());
+        }
+
+    private:
+        /// Class helpers
+
+        /**
+         * Item storage
+         */
+        union Item
+        {
+            constexpr Item() : Double()
+            {
+            }
+
+            constexpr Item(bool value) : Boolean(value)
+            {
+            }
+
+            constexpr Item(char value) : Char(value)
+            {
+            }
+
+            constexpr Item(signed char value) : SChar(value)
+            {
+            }
+
+            constexpr Item(unsigned char value) : UChar(value)
+            {
+            }
+
+            constexpr Item(short value) : Short(value)
+            {
+            }
+
+            constexpr Item(unsigned short value) : UShort(value)
+            {
+            }
+
+            constexpr Item(int value) : Int(value)
+            {
+            }
+
+            constexpr Item(unsigned int value) : UInt(value)
+            {
+            }
+
+            constexpr Item(long value) : Long(value)
+            {
+            }
+
+            constexpr Item(unsigned long value) : ULong(value)
+            {
+            }
+
+            constexpr Item(long long value) : LongLong(value)
+            {
+            }
+
+            constexpr Item(unsigned long long value) : ULongLong(value)
+            {
+            }
+
+            constexpr Item(float value) : Float(value)
+            {
+            }
+
+            constexpr Item(double value) : Double(value)
+            {
+            }
+
+            constexpr Item(Symbol value) : Interned(value)
+            {
+            }
+
+            bool Boolean;
+            char Char;
+            signed char SChar;
+            unsigned char UChar;
+            short Short;
+            unsigned short UShort;
+            int Int;
+            unsigned int UInt;
+            long Long;
+            unsigned long ULong;
+            long long LongLong;
+            unsigned long long ULongLong;
+            float Float;
+            double Double;
+            ShortString String;
+            Symbol Interned;
+        };
+
+        /**
+         * Compares the item with the one of a value of the same kind
+         */
+        struct Comparator
+        {
+            const ScalarValue &Other;
+
+            template<typename T>
+            inline Ordering operator()(const T &item) const
+            {
+                return Operators::ThreeWay<T>::Compare(item,
+                    this->Other.Ref<T>());
+            }
+
+            inline Ordering operator()(const ShortString &item) const
+            {
+                return Operators::Impl::ToOrdering(item.compare(
+                    this->Other.m_Item.String));
+            }
+
+            inline Ordering operator()(const Symbol &item) const
+            {
+                return Operators::Impl::ToOrdering(item.compare(
+                    this->Other.m_Item.Interned));
+            }
+
+            inline Ordering operator()(std::nullptr_t) const
+            {
+                return Ordering::Equal;
+            }
+        };
+
+        /**
+         * Hashes the item as the object boxing it does
+         */
+        struct Hasher
+        {
+            template<typename T>
+            inline size_t operator()(const T &item) const
+            {
+                return Operators::Hash<T>()(item);
+            }
+
+            inline size_t operator()(const ShortString &item) const
+            {
+                return Operators::Hash<std::string>::Hash(item.Data,
+                                                          item.Size);
+            }
+
+            inline size_t operator()(const Symbol &item) const
+            {
+                return item.GetHash();
+            }
+
+            inline size_t operator()(std::nullptr_t) const
+            {
+                return 0;
+            }
+        };
+
+        /**
+         * Returns the item, unchecked
+         * @return A const reference to the item
+         */
+        template<typename T>
+        inline const T &Ref() const
+        {
+            return reinterpret_cast<const T &>(this->m_Item);
+        }
+
+        /**
+         * Copies a string inline
+         * @param value String characters
+         * @param size Number of characters
+         * @throw std::length_error If the string is longer than
+         * MaxStringSize characters
+         */
+        inline void Assign(const char *value, size_t size)
+        {
+            if(size > MaxStringSize)
+            {
+                throw std::length_error("ScalarValue string too long");
+            }
+
+            std::char_traits<char>::copy(this->m_Item.String.Data, value,
+                                         size);
+            this->m_Item.String.Size = static_cast<uint8_t>(size);
+        }
+
+        /**
+         * Orders values of different kinds, as the objects boxing them are
+         * ordered, null goes first
+         * @param o Value to compare with
+         * @return Ordering of the value relative to o
+         */
+        Ordering CompareKind(const ScalarValue &o) const;
+
+        /// Class attributes
+
+        /**
+         * Value kind
+         */
+        Kind m_Kind;
+
+        /**
+         * Value item
+         */
+        Item m_Item;
+    };
+
+    /**
+     * Kind of the values holding an item type
+     */
+    template<ScalarValue::Kind K>
+    using ScalarKind = std::integral_constant<ScalarValue::Kind, K>;
+
+    template<>
+    struct ScalarKindOf<bool> : public ScalarKind<ScalarValue::Kind::Boolean>
+    {
+    };
+
+    template<>
+    struct ScalarKindOf<char> : public ScalarKind<ScalarValue::Kind::Char>
+    {
+    };
+
+    template<>
+    struct ScalarKindOf<signed char> :
+    public ScalarKind<ScalarValue::Kind::SChar>
+    {
+    };
+
+    template<>
+    struct ScalarKindOf<unsigned char> :
+    public ScalarKind<ScalarValue::Kind::UChar>
+    {
+    };
+
+    template<>
+    struct ScalarKindOf<short> : public ScalarKind<ScalarValue::Kind::Short>
+    {
+    };
+
+    template<>
+    struct ScalarKindOf<unsigned short> :
+    public ScalarKind<ScalarValue::Kind::UShort>
+    {
+    };
+
+    template<>
+    struct ScalarKindOf<int> : public ScalarKind<ScalarValue::Kind::Int>
+    {
+    };
+
+    template<>
+    struct ScalarKindOf<unsigned int> :
+    public ScalarKind<ScalarValue::Kind::UInt>
+    {
+    };
+
+    template<>
+    struct ScalarKindOf<long> : public ScalarKind<ScalarValue::Kind::Long>
+    {
+    };
+
+    template<>
+    struct ScalarKindOf<unsigned long> :
+    public ScalarKind<ScalarValue::Kind::ULong>
+    {
+    };
+
+    template<>
+    struct ScalarKindOf<long long> :
+    public ScalarKind<ScalarValue::Kind::LongLong>
+    {
+    };
+
+    template<>
+    struct ScalarKindOf<unsigned long long> :
+    public ScalarKind<ScalarValue::Kind::ULongLong>
+    {
+    };
+
+    template<>
+    struct ScalarKindOf<float> : public ScalarKind<ScalarValue::Kind::Float>
+    {
+    };
+
+    template<>
+    struct ScalarKindOf<double> : public ScalarKind<ScalarValue::Kind::Double>
+    {
+    };
+
+    template<>
+    struct ScalarKindOf<Symbol> : public ScalarKind<ScalarValue::Kind::Symbol>
+    {
+    };
+
+    /**
+     * Stream operator for scalar values
+     * @param os Output stream
+     * @param item Value to write to the stream
+     * @return Modified stream
+     */
+    std::ostream &operator<<(std::ostream &os, const ScalarValue &item);
+}
+
+
+// Hash implementation
+namespace std
+{
+    template<>
+    struct hash<DynObjects::ScalarValue>
+    {
+        size_t operator()(const DynObjects::ScalarValue &__v) const noexcept
+        {
+            return __v.hash();
+        }
+    };
+}
+
+#endif /* DYNOBJECTS_SCALAR_VALUE_H */
@@ -0,0 +1,342 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   Shape.h
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 20:45
+ */
+
+#ifndef DYNOBJECTS_SHAPE_H
+#define DYNOBJECTS_SHAPE_H
+
+/// Internal libs includes
+#include "FlatHashMap.h"
+#include "Operators.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+/**
+ * DynObjects library namespace
+ */
+namespace DynObjects
+{
+    /**
+     * Record shape, the ordered field names shared by records
+     * @note Shapes form a tree rooted at the empty shape (see GetRoot), each
+     * child adds one field to its parent. Adding the same field to the same
+     * shape always gives the same child, so records built by adding the same
+     * fields in the same order share their shape. Shared shapes are never
+     * destroyed, so a shape has at most MaxTransitions children and there
+     * are at most MaxShapes shared shapes: past that, records get a shape of
+     * their own (see Derive), freed with them
+     */
+    class Shape
+    {
+    public:
+        /**
+         * Index returned for missing fields
+         */
+        static const size_t NoField = static_cast<size_t>(-1);
+
+        /**
+         * Maximum number of child shapes of a shared shape
+         */
+        static const size_t MaxTransitions = 256;
+
+        /**
+         * Maximum number of shared shapes, besides the root
+         */
+        static const size_t MaxShapes = 16384;
+
+        /// Class implementations
+
+        /**
+         * Returns the empty shape
+         * @return Root of the shapes tree
+         */
+        static const Shape &GetRoot();
+
+        /**
+         * Returns the shape with one more field
+         * @param name Name of the new field
+         * @return Child shape, created on first use, or the shape itself if
+         * it has the field already
+         * @throw std::length_error If the shape has no such child and can
+         * not have more (see TryAddField)
+         * @note Thread-safe
+         */
+        const Shape &AddField(const std::string &name) const;
+
+        /**
+         * Returns the shape with one more field, if it can be shared
+         * @param name Name of the new field
+         * @return Child shape, created on first use, the shape itself if it
+         * has the field already, or null if the shape has no such child and
+         * can not have more: it has MaxTransitions children already, there
+         * are MaxShapes shared shapes already or it is not shared
+         * @note Thread-safe
+         */
+        const Shape *TryAddField(const std::string &name) const;
+
+        /**
+         * Builds a shape of its own with one more field
+         * @param name Name of the new field
+         * @return New shape, not shared with other records
+         */
+        std::shared_ptr<Shape> Derive(const std::string &name) const;
+
+        /**
+         * Returns the number of shared shapes
+         * @return Number of shared shapes besides the root, at most
+         * MaxShapes
+         */
+        static size_t GetSharedCount();
+
+        /**
+         * Adds a field to a shape of its own, see Derive
+         * @param name Name of the new field
+         * @note Only for shapes no record but the caller uses
+         */
+        void Append(const std::string &name);
+
+        /**
+         * Finds a field
+         * @param name Field name
+         * @return Field index, or NoField if the shape has no such field
+         */
+        size_t FindField(const std::string &name) const;
+
+        /**
+         * Returns the shape identifier
+         * @return Identifier, unique within the process, or zero for the
+         * shapes of their own
+         */
+        inline uint32_t GetId() const
+        {
+            return this->m_Id;
+        }
+
+        /**
+         * Returns whether or not the shape is shared, see Derive
+         * @return Whether or not the shape is in the shapes tree
+         */
+        inline bool IsShared() const
+        {
+            return this->m_Id != 0;
+        }
+
+        /**
+         * Returns the number of fields
+         * @return Number of fields
+         */
+        inline size_t GetSize() const
+        {
+            return this->m_Names.size();
+        }
+
+        /**
+         * Returns the name of a field
+         * @param index Field index
+         * @return Field name
+         */
+        inline const std::string &GetFieldName(size_t index) const
+        {
+            return this->m_Names[index];
+        }
+
+        /**
+         * Returns the field indices in the order of their names
+         * @return Field indices sorted by name
+         */
+        inline const std::vector<uint32_t> &GetSortedFields() const
+        {
+            return this->m_Sorted;
+        }
+
+        /**
+         * Returns the number of fields of the biggest shape grown from this
+         * one so far
+         * @return Number of fields records of this shape are expected to
+         * reach, used to size their storage
+         */
+        inline size_t GetCapacityHint() const
+        {
+            return this->m_CapacityHint.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * Returns the shape this one adds a field to
+         * @return Parent shape, or null for the root and the shapes of
+         * their own
+         */
+        inline const Shape *GetParent() const
+        {
+            return this->m_Parent;
+        }
+
+    private:
+        /// Class constructors
+
+        /**
+         * Class constructor
+         * @param parent Parent shape, or null for the root
+         * @param name Name of the added field
+         * @param shared Whether or not the shape joins the shapes tree
+         */
+        Shape(const Shape *parent, const std::string &name, bool shared);
+
+        /**
+         * Prevents the use of the copy constructor
+         */
+        Shape(const Shape &) = delete;
+
+        /**
+         * Prevents the use of the copy operator
+         */
+        void operator=(const Shape &) = delete;
+
+        /// Class attributes
+
+        /**
+         * Parent shape
+         */
+        const Shape *m_Parent;
+
+        /**
+         * Shape identifier
+         */
+        uint32_t m_Id;
+
+        /**
+         * Field names, by index
+         */
+        std::vector<std::string> m_Names;
+
+        /**
+         * Field indices sorted by name
+         */
+        std::vector<uint32_t> m_Sorted;
+
+        /**
+         * Field indices, by name
+         */
+        FlatHashMap<std::string, size_t, Operators::Hash<std::string>>
+            m_Index;
+
+        /**
+         * Child shapes, by added field name
+         */
+        mutable FlatHashMap<std::string, const Shape *,
+            Operators::Hash<std::string>> m_Transitions;
+
+        /**
+         * Number of fields of the biggest descendant
+         */
+        mutable std::atomic<size_t> m_CapacityHint;
+
+        /**
+         * Child shapes mutex
+         */
+        mutable std::mutex m_Mutex;
+    };
+
+    /**
+     * Field name with an inline cache of its index
+     * @note Meant to be a static at each call site: while the records seen
+     * there share their shape, the field is found without looking it up.
+     * The cache is a single atomic word, so keys can be shared by threads
+     */
+    class FieldKey
+    {
+    public:
+        /// Class constructors
+
+        /**
+         * Class constructor
+         * @param name Field name
+         */
+        explicit FieldKey(const std::string &name) : m_Name(name), m_Cache(0)
+        {
+        }
+
+        /// Class implementations
+
+        /**
+         * Returns the field name
+         * @return Field name
+         */
+        inline const std::string &GetName() const
+        {
+            return this->m_Name;
+        }
+
+        /**
+         * Finds the field in a shape
+         * @param shape Shape to look the field up in
+         * @return Field index, or Shape::NoField if the shape has no such
+         * field
+         */
+        inline size_t Find(const Shape &shape) const
+        {
+            uint64_t cache = this->m_Cache.load(std::memory_order_relaxed);
+            if(static_cast<uint32_t>(cache >> 32) == shape.GetId() &&
+               shape.IsShared())
+            {
+                return static_cast<uint32_t>(cache);
+            }
+
+            // Shapes of their own change in place, they are not cached
+            size_t index = shape.FindField(this->m_Name);
+            if(index != Shape::NoField && shape.IsShared())
+            {
+                this->m_Cache.store(
+                    static_cast<uint64_t>(shape.GetId()) << 32 | index,
+                    std::memory_order_relaxed);
+            }
+
+            return index;
+        }
+
+    private:
+        /// Class attributes
+
+        /**
+         * Field name
+         */
+        std::string m_Name;
+
+        /**
+         * Identifier of the last shape the field was found in, high bits,
+         * and the index of the field there, low bits
+         */
+        mutable std::atomic<uint64_t> m_Cache;
+    };
+}
+
+#endif /* DYNOBJECTS_SHAPE_H */
+
@@ -26,7 +26,9 @@
 #define DYNOBJECTS_STANDARD_H
 
 /// Internal libs includes
+#include "Basic.h"
 #include "Generic.h"
+#include "FlatHashMap.h"
 
 /// External libs 
 
@@ -35,28 +37,225 @@
 #include <map>
 #include <list>
 #include <queue>
+#include <string>
 #include <vector>
 #include <unordered_map>
 
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+
 /**
  * DynObjects library namespace
  */
 namespace DynObjects
 {
-    // Helper class
+    /**
+     * Dictionary keys comparator
+     * @note Strict weak ordering over keys of any type: objects of different
+     * types are ordered by type identifier, then by their total order (see
+     * Object::TotalCompare), so NaN and unordered containers are keys too
+     */
     struct DictionaryComparator :
     public std::binary_function<ObjectPtr, ObjectPtr, bool>
     {
         bool operator()(const ObjectPtr& __x, const ObjectPtr& __y) const
         {
-            try
+            return __x.TotalCompare(__y) == Ordering::Less;
+        }
+    };
+
+    /**
+     * Raw dictionary key trait
+     * @note Specialized for the raw keys that can be looked up in a
+     * Dictionary without boxing them: type is the dynamic type the key is
+     * boxed in, Hash matches the hash() of that type and Equals compares
+     * its payload against the raw key
+     */
+    template<typename _K, typename = void>
+    struct RawKey {};
+
+    // Character type check
+    template<typename _CharT>
+    using IsCharType = std::integral_constant<bool,
+        std::is_same<_CharT, char>::value ||
+        std::is_same<_CharT, wchar_t>::value ||
+        std::is_same<_CharT, char16_t>::value ||
+        std::is_same<_CharT, char32_t>::value>;
+
+    // Raw arithmetic keys, boxed in Basic
+    template<typename _K>
+    struct RawKey<_K, typename std::enable_if<
+        std::is_arithmetic<_K>::value>::type>
+    {
+        typedef Basic<_K> type;
+
+        static inline size_t Hash(const _K &key)
+        {
+            return Operators::Hash<_K>()(key);
+        }
+
+        static inline bool Equals(const type &o, const _K &key)
+        {
+            return *o == key;
+        }
+    };
+
+    // Raw string keys, boxed in Generic
+    template<typename _CharT, typename _Traits, typename _Alloc>
+    struct RawKey<std::basic_string<_CharT, _Traits, _Alloc>, void>
+    {
+        typedef std::basic_string<_CharT, _Traits, _Alloc> value_type;
+        typedef Generic<value_type> type;
+
+        static inline size_t Hash(const value_type &key)
+        {
+            return Operators::Hash<value_type>()(key);
+        }
+
+        static inline bool Equals(const type &o, const value_type &key)
+        {
+            return *o == key;
+        }
+
+        static inline bool Equals(const ImmutableString<_CharT, _Traits> &o,
+                                  const value_type &key)
+        {
+            return o.Equals(key.data(), key.size());
+        }
+    };
+
+    // Raw null-terminated string keys, boxed as strings
+    template<typename _CharT>
+    struct RawKey<const _CharT *, typename std::enable_if<
+        IsCharType<_CharT>::value>::type>
+    {
+        typedef std::basic_string<_CharT> value_type;
+        typedef Generic<value_type> type;
+
+        static inline size_t Hash(const _CharT *key)
+        {
+            return Operators::Hash<value_type>::Hash(key,
+                std::char_traits<_CharT>::length(key));
+        }
+
+        static inline bool Equals(const type &o, const _CharT *key)
+        {
+            return (*o).compare(key) == 0;
+        }
+
+        static inline bool Equals(const ImmutableString<_CharT> &o,
+                                  const _CharT *key)
+        {
+            return o.Equals(key, std::char_traits<_CharT>::length(key));
+        }
+    };
+
+    template<typename _CharT>
+    struct RawKey<_CharT *, typename std::enable_if<
+        IsCharType<_CharT>::value>::type> :
+    public RawKey<const _CharT *> {};
+
+    template<typename _CharT, size_t _N>
+    struct RawKey<_CharT[_N], typename std::enable_if<
+        IsCharType<_CharT>::value>::type> :
+    public RawKey<const _CharT *> {};
+
+#if __cplusplus >= 201703L
+    // Raw string view keys, boxed as strings
+    template<typename _CharT, typename _Traits>
+    struct RawKey<std::basic_string_view<_CharT, _Traits>, void>
+    {
+        typedef std::basic_string_view<_CharT, _Traits> view_type;
+        typedef std::basic_string<_CharT, _Traits> value_type;
+        typedef Generic<value_type> type;
+
+        static inline size_t Hash(const view_type &key)
+        {
+            return Operators::Hash<value_type>::Hash(key.data(), key.size());
+        }
+
+        static inline bool Equals(const type &o, const view_type &key)
+        {
+            return static_cast<const value_type &>(o).compare(key) == 0;
+        }
+
+        static inline bool Equals(const ImmutableString<_CharT, _Traits> &o,
+                                  const view_type &key)
+        {
+            return o.Equals(key.data(), key.size());
+        }
+    };
+#endif
+
+    /**
+     * Dictionary keys hash function
+     * @note Transparent: raw keys (see RawKey) hash as their boxed objects
+     */
+    struct DictionaryHash
+    {
+        typedef void is_transparent;
+
+        inline size_t operator()(const ObjectPtr &__s) const
+        {
+            return (*__s).hash();
+        }
+
+        template<typename _K>
+        inline size_t operator()(const _K &__s, typename RawKey<_K>::type * =
+                                 nullptr) const
+        {
+            return RawKey<_K>::Hash(__s);
+        }
+    };
+
+    /**
+     * Dictionary keys equality
+     * @note Transparent: raw keys (see RawKey) are compared in place with
+     * the payload of objects of their boxed type or its immutable peer, and
+     * are never equal to objects of other types
+     */
+    struct DictionaryEqual
+    {
+        typedef void is_transparent;
+
+        inline bool operator()(const ObjectPtr &__x, const ObjectPtr &__y) const
+        {
+            return __x == __y;
+        }
+
+        template<typename _K>
+        inline bool operator()(const ObjectPtr &__x, const _K &__y,
+                               typename RawKey<_K>::type * = nullptr) const
+        {
+            typedef typename RawKey<_K>::type _Type;
+            const Object &o = *__x;
+
+            if(o.GetObjectTypeId() == GetTypeId<_Type>())
             {
-                return __x < __y;
+                return RawKey<_K>::Equals(static_cast<const _Type &>(o), __y);
             }
-            catch(std::bad_cast &)
-            {
-                return false;
-            } 
+
+            return EqualsPeer(o, __y, 0);
+        }
+
+    private:
+        /**
+         * Compares a raw key with an object of the immutable peer type of
+         * its boxed type (see ImmutablePeer)
+         */
+        template<typename _K, typename _Peer = typename ImmutablePeer<
+            typename RawKey<_K>::value_type>::type>
+        static inline bool EqualsPeer(const Object &o, const _K &__y, int)
+        {
+            return o.GetObjectTypeId() == GetTypeId<_Peer>() &&
+                RawKey<_K>::Equals(static_cast<const _Peer &>(o), __y);
+        }
+
+        template<typename _K>
+        static inline bool EqualsPeer(const Object &, const _K &, long)
+        {
+            return false;
         }
     };
 
@@ -77,8 +276,20 @@ namespace DynObjects
              class _Alloc = std::allocator<std::pair<const _Key, _Tp> > >
     using UnorderedMap = GenericInstance<std::unordered_map<_Key, _Tp, _Hash, _Pred, _Alloc>>;
 
-    // Dictionary class
-    typedef UnorderedMap<ObjectPtr, ObjectPtr> Dictionary;
+    // Flat hash map class, see FlatHashMap for the invalidation rules
+    template<class _Key, class _Tp,
+             class _Hash = std::hash<_Key>,
+             class _Pred = std::equal_to<_Key>,
+             class _Alloc = std::allocator<std::pair<const _Key, _Tp> > >
+    using FlatMap = GenericInstance<FlatHashMap<_Key, _Tp, _Hash, _Pred, _Alloc>>;
+
+    // Dictionary class, references to its items do not survive insertions.
+    // Raw keys can be looked up without boxing them, see RawKey
+    typedef FlatMap<ObjectPtr, ObjectPtr, DictionaryHash, DictionaryEqual>
+        Dictionary;
+
+    // Dictionary class with stable references to its items
+    typedef UnorderedMap<ObjectPtr, ObjectPtr> NodeDictionary;
 
     // List class
     template<typename _Tp, typename _Alloc = std::allocator<_Tp>>
@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   TypeRegistry.h
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 10:12
+ */
+
+#ifndef DYNOBJECTS_TYPE_REGISTRY_H
+#define DYNOBJECTS_TYPE_REGISTRY_H
+
+/// External libs includes
+
+// C++11 standard
+#include <cstdint>
+#include <string>
+#include <typeinfo>
+
+
+/**
+ * DynObjects library namespace
+ */
+namespace DynObjects
+{
+    /**
+     * Dynamic type identifier
+     * @note Zero is never assigned to any type. Types get even identifiers,
+     * ordering peers (see OrderPeerOf) the one right after their peer
+     */
+    typedef uint32_t TypeId;
+
+    /**
+     * Value type trait
+     * @note Specialized by the dynamic types to name the encapsulated type
+     */
+    template<typename _Type>
+    struct ValueTypeOf
+    {
+        typedef _Type type;
+    };
+
+    /**
+     * Registered type information
+     * @note Instances live until the process ends
+     */
+    class TypeInfo
+    {
+    public:
+        /// Class constructors
+
+        /**
+         * Class constructor
+         * @param id Type identifier
+         * @param type Dynamic type
+         * @param name Demangled name of the encapsulated type
+         */
+        TypeInfo(TypeId id, const std::type_info &type,
+                 const std::string &name);
+
+        /// Class implementations
+
+        /**
+         * Returns the type identifier
+         * @return Type identifier
+         */
+        inline TypeId GetId() const
+        {
+            return this->m_Id;
+        }
+
+        /**
+         * Returns the dynamic type
+         * @return Dynamic type information
+         */
+        inline const std::type_info &GetType() const
+        {
+            return this->m_Type;
+        }
+
+        /**
+         * Returns the demangled name of the encapsulated type
+         * @return Type name
+         */
+        inline const std::string &GetName() const
+        {
+            return this->m_Name;
+        }
+
+        /**
+         * Returns the name of pointers to the type
+         * @return Pointer type name
+         */
+        inline const std::string &GetPointerName() const
+        {
+            return this->m_PointerName;
+        }
+
+    private:
+        /// Class attributes
+
+        /**
+         * Type identifier
+         */
+        const TypeId m_Id;
+
+        /**
+         * Dynamic type
+         */
+        const std::type_info &m_Type;
+
+        /**
+         * Type name
+         */
+        const std::string m_Name;
+
+        /**
+         * Pointer type name
+         */
+        const std::string m_PointerName;
+    };
+
+    /**
+     * Process-wide type registry
+     * @note Registration is serialized, lookups never lock
+     */
+    class TypeRegistry
+    {
+    public:
+        /**
+         * Registers a dynamic type
+         * @param type Dynamic type
+         * @param value Encapsulated type, used to name the dynamic type
+         * @param peer Ordering peer type information, or null
+         * @return Type information, unique for each dynamic type
+         * @throw std::logic_error If the peer has an ordering peer already
+         */
+        static const TypeInfo &Register(const std::type_info &type,
+                                        const std::type_info &value,
+                                        const TypeInfo *peer = nullptr);
+
+        /**
+         * Finds a type by its identifier
+         * @param id Type identifier
+         * @return Type information, or null if the type is not registered
+         */
+        static const TypeInfo *Find(TypeId id);
+
+        /**
+         * Finds a type by its name
+         * @param name Demangled name of the encapsulated type
+         * @return Type information of the first type registered with that
+         * name, or null if there is none
+         */
+        static const TypeInfo *Find(const std::string &name);
+    };
+
+    /**
+     * Ordering peer trait
+     * @note Specialized by the dynamic types ordered among the other types
+     * as another one is: GetInfo returns the type information of that
+     * peer. Identifiers follow the one of the peer, so comparing them
+     * (see Object::CompareTypeId) puts both types in the same place
+     */
+    template<typename _Type>
+    struct OrderPeerOf
+    {
+        static inline const TypeInfo *GetInfo()
+        {
+            return nullptr;
+        }
+    };
+
+    /**
+     * Returns the type information of a dynamic type
+     * @return Type information, registered on first use
+     */
+    template<typename _Type>
+    inline const TypeInfo &GetTypeInfo()
+    {
+        static const TypeInfo &info = TypeRegistry::Register(typeid(_Type),
+            typeid(typename ValueTypeOf<_Type>::type),
+            OrderPeerOf<_Type>::GetInfo());
+        return info;
+    }
+
+    /**
+     * Returns the type identifier of a dynamic type
+     * @return Type identifier, assigned on first use
+     */
+    template<typename _Type>
+    inline TypeId GetTypeId()
+    {
+        static const TypeId id = GetTypeInfo<_Type>().GetId();
+        return id;
+    }
+}
+
+#endif /* DYNOBJECTS_TYPE_REGISTRY_H */
+
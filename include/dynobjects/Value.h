@@ -0,0 +1,633 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   Value.h
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 23:00
+ */
+
+#ifndef DYNOBJECTS_VALUE_H
+#define DYNOBJECTS_VALUE_H
+
+/// Internal libs includes
+#include "Basic.h"
+#include "Object.h"
+#include "Operators.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <ostream>
+#include <type_traits>
+#include <typeinfo>
+
+
+/**
+ * DynObjects library namespace
+ */
+namespace DynObjects
+{
+    /**
+     * Tagged value, a single 64-bit word
+     * @note Doubles are stored as they are, with a single NaN. Null,
+     * booleans, 32-bit integers and object references are stored in the
+     * payload of the NaNs no double is ever stored as. Scalars never touch
+     * memory. Object references point to the object with intrusive
+     * reference counting, to a shared box holding the object pointer
+     * otherwise. Values order, compare and hash as the objects they box
+     * (see ToObject), Basic<bool>, Basic<int32_t> and Basic<double>
+     * objects are always stored as scalars
+     */
+    class Value
+    {
+    public:
+        /**
+         * Value kinds
+         */
+        enum class Kind : uint8_t
+        {
+            Null,
+            Boolean,
+            Integer,
+            Object,
+            Double
+        };
+
+        /// Class constructors
+
+        /**
+         * Class default constructor, the null value
+         */
+        inline Value() : m_Bits(NullBits)
+        {
+        }
+
+        inline Value(std::nullptr_t) : m_Bits(NullBits)
+        {
+        }
+
+        /**
+         * Class constructor with a scalar
+         * @param value Scalar value
+         */
+        inline Value(bool value) :
+        m_Bits(BooleanTag | static_cast<uint64_t>(value))
+        {
+        }
+
+        inline Value(int32_t value) :
+        m_Bits(IntegerTag | static_cast<uint32_t>(value))
+        {
+        }
+
+        inline Value(double value) : m_Bits(FromDouble(value))
+        {
+        }
+
+        /**
+         * Class constructor with another arithmetic type
+         * @param value Item, boxed in a Basic object
+         */
+        template<typename T, typename = typename std::enable_if<
+            std::is_arithmetic<T>::value && !std::is_same<T, bool>::value &&
+            !std::is_same<T, int32_t>::value &&
+            !std::is_same<T, double>::value>::type>
+        inline Value(T value) :
+        m_Bits(FromObject(MakeObject<Basic<T>>(value)))
+        {
+        }
+
+        /**
+         * Prevents character pointers from being taken as booleans
+         */
+        template<typename T>
+        Value(const T *) = delete;
+
+        /**
+         * Class constructor with an object pointer
+         * @param ptr Object pointer, null for the null value
+         */
+        inline Value(const ObjectPtr &ptr) : m_Bits(FromObject(ptr))
+        {
+        }
+
+        /**
+         * Class copy constructor
+         * @param o Value to copy
+         */
+        inline Value(const Value &o) : m_Bits(o.m_Bits)
+        {
+            if(this->IsObject())
+            {
+                Retain(this->m_Bits);
+            }
+        }
+
+        /**
+         * Class move constructor
+         * @param o Value to move, left null
+         */
+        inline Value(Value &&o) noexcept : m_Bits(o.m_Bits)
+        {
+            o.m_Bits = NullBits;
+        }
+
+        /**
+         * Class destructor
+         */
+        inline ~Value()
+        {
+            if(this->IsObject())
+            {
+                Release(this->m_Bits);
+            }
+        }
+
+        /// Class operators
+
+        /**
+         * Copy assignation operator
+         * @param o Value to copy
+         * @return A reference to itself
+         */
+        inline Value &operator=(const Value &o)
+        {
+            if(o.IsObject())
+            {
+                Retain(o.m_Bits);
+            }
+
+            if(this->IsObject())
+            {
+                Release(this->m_Bits);
+            }
+
+            this->m_Bits = o.m_Bits;
+            return *this;
+        }
+
+        /**
+         * Move assignation operator
+         * @param o Value to move, left null
+         * @return A reference to itself
+         */
+        inline Value &operator=(Value &&o) noexcept
+        {
+            if(this != &o)
+            {
+                if(this->IsObject())
+                {
+                    Release(this->m_Bits);
+                }
+
+                this->m_Bits = o.m_Bits;
+                o.m_Bits = NullBits;
+            }
+
+            return *this;
+        }
+
+        inline bool operator==(const Value &o) const
+        {
+            return this->compare(o) == Ordering::Equal;
+        }
+
+        inline bool operator!=(const Value &o) const
+        {
+            return this->compare(o) != Ordering::Equal;
+        }
+
+        inline bool operator<(const Value &o) const
+        {
+            return this->compare(o) == Ordering::Less;
+        }
+
+        inline bool operator>(const Value &o) const
+        {
+            return this->compare(o) == Ordering::Greater;
+        }
+
+        inline bool operator<=(const Value &o) const
+        {
+            Ordering result = this->compare(o);
+            return result == Ordering::Less || result == Ordering::Equal;
+        }
+
+        inline bool operator>=(const Value &o) const
+        {
+            Ordering result = this->compare(o);
+            return result == Ordering::Greater || result == Ordering::Equal;
+        }
+
+        /// Class implementations
+
+        /**
+         * Returns the value kind
+         * @return Value kind
+         */
+        inline Kind GetKind() const
+        {
+            return this->m_Bits < NullBits ? Kind::Double :
+                static_cast<Kind>((this->m_Bits - NullBits) >> 48);
+        }
+
+        inline bool IsNull() const
+        {
+            return this->m_Bits == NullBits;
+        }
+
+        inline bool IsBoolean() const
+        {
+            return (this->m_Bits & TagMask) == BooleanTag;
+        }
+
+        inline bool IsInteger() const
+        {
+            return (this->m_Bits & TagMask) == IntegerTag;
+        }
+
+        inline bool IsDouble() const
+        {
+            return this->m_Bits < NullBits;
+        }
+
+        inline bool IsNumber() const
+        {
+            return this->IsInteger() || this->IsDouble();
+        }
+
+        inline bool IsObject() const
+        {
+            return (this->m_Bits & TagMask) == ObjectTag;
+        }
+
+        /**
+         * Returns the boolean
+         * @return Boolean
+         * @throw std::bad_cast If the value is not a boolean
+         */
+        inline bool AsBoolean() const
+        {
+            Check(this->IsBoolean());
+            return (this->m_Bits & 1) != 0;
+        }
+
+        /**
+         * Returns the integer
+         * @return Integer
+         * @throw std::bad_cast If the value is not an integer
+         */
+        inline int32_t AsInteger() const
+        {
+            Check(this->IsInteger());
+            return static_cast<int32_t>(static_cast<uint32_t>(this->m_Bits));
+        }
+
+        /**
+         * Returns the double
+         * @return Double
+         * @throw std::bad_cast If the value is not a double
+         */
+        inline double AsDouble() const
+        {
+            Check(this->IsDouble());
+
+            double value;
+            std::memcpy(&value, &this->m_Bits, sizeof(value));
+            return value;
+        }
+
+        /**
+         * Returns the number, integers are converted
+         * @return Number
+         * @throw std::bad_cast If the value is not a number
+         */
+        inline double AsNumber() const
+        {
+            return this->IsInteger() ? this->AsInteger() : this->AsDouble();
+        }
+
+        /**
+         * Returns the referenced object
+         * @return A reference to the object
+         * @throw std::bad_cast If the value is not an object
+         */
+        inline Object &GetObject() const
+        {
+            Check(this->IsObject());
+#ifdef DYNOBJECTS_INTRUSIVE_REFCOUNT
+            return *reinterpret_cast<Object *>(this->m_Bits & PayloadMask);
+#else
+            return *reinterpret_cast<Box *>(this->m_Bits & PayloadMask)->
+                Pointer;
+#endif
+        }
+
+        /**
+         * Returns the value as an object pointer
+         * @return Object pointer, scalars are boxed in new Basic objects
+         * and null is the null pointer
+         */
+        ObjectPtr ToObject() const;
+
+        /**
+         * Three-way comparison method
+         * @param o Value to compare with
+         * @return Ordering of the value relative to o
+         */
+        inline Ordering compare(const Value &o) const
+        {
+            if(this->IsInteger() && o.IsInteger())
+            {
+                return Operators::ThreeWay<int32_t>::Compare(
+                    this->AsInteger(), o.AsInteger());
+            }
+
+            if(this->IsDouble() && o.IsDouble())
+            {
+                return Operators::ThreeWay<double>::Compare(
+                    this->AsDouble(), o.AsDouble());
+            }
+
+            return this->CompareOther(o);
+        }
+
+        /**
+         * Hashing method
+         * @return Hash of the value, the one of the boxed object
+         */
+        inline size_t hash() const
+        {
+            switch(this->GetKind())
+            {
+            case Kind::Boolean:
+                return Operators::Hash<bool>()(this->AsBoolean());
+            case Kind::Integer:
+                return Operators::Hash<int32_t>()(this->AsInteger());
+            case Kind::Double:
+                return Operators::Hash<double>()(this->AsDouble());
+            case Kind::Object:
+                return this->GetObject().hash();
+            default:
+                return 0;
+            }
+        }
+
+        /**
+         * Builds an integer value, a double if it does not fit
+         * @param value Integer
+         * @return Value
+         */
+        static inline Value FromInteger(int64_t value)
+        {
+            return value >= INT32_MIN && value <= INT32_MAX ?
+                Value(static_cast<int32_t>(value)) :
+                Value(static_cast<double>(value));
+        }
+
+    private:
+#ifndef DYNOBJECTS_INTRUSIVE_REFCOUNT
+        /**
+         * Shared object box
+         */
+        struct Box
+        {
+            /**
+             * Class constructor, with a single reference
+             * @param ptr Object pointer to box
+             */
+            explicit Box(const ObjectPtr &ptr) : Count(1), Pointer(ptr)
+            {
+            }
+
+            /**
+             * Number of values referencing the box
+             */
+            std::atomic<uint32_t> Count;
+
+            /**
+             * Boxed object pointer
+             */
+            ObjectPtr Pointer;
+        };
+#endif
+
+        /// Class helpers
+
+        /**
+         * Fails if a value is not of the expected kind
+         * @param expected Whether or not the value is of the expected kind
+         * @throw std::bad_cast If it is not
+         */
+        static inline void Check(bool expected)
+        {
+            if(!expected)
+            {
+                throw std::bad_cast();
+            }
+        }
+
+        /**
+         * Encodes a double
+         * @param value Double
+         * @return Value bits, NaNs are made the canonical one
+         */
+        static inline uint64_t FromDouble(double value)
+        {
+            if(value != value)
+            {
+                return CanonicalNaN;
+            }
+
+            uint64_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+
+        /**
+         * Encodes an object pointer
+         * @param ptr Object pointer
+         * @return Value bits, scalars of the value kinds are unboxed
+         */
+        static uint64_t FromObject(const ObjectPtr &ptr);
+
+        /**
+         * Acquires a reference to the object of a value
+         * @param bits Object value bits
+         */
+        static inline void Retain(uint64_t bits)
+        {
+#ifdef DYNOBJECTS_INTRUSIVE_REFCOUNT
+            reinterpret_cast<Object *>(bits & PayloadMask)->AddRef();
+#else
+            reinterpret_cast<Box *>(bits & PayloadMask)->Count.fetch_add(1,
+                std::memory_order_relaxed);
+#endif
+        }
+
+        /**
+         * Releases a reference to the object of a value
+         * @param bits Object value bits
+         */
+        static inline void Release(uint64_t bits)
+        {
+#ifdef DYNOBJECTS_INTRUSIVE_REFCOUNT
+            reinterpret_cast<Object *>(bits & PayloadMask)->Release();
+#else
+            Box *box = reinterpret_cast<Box *>(bits & PayloadMask);
+
+            if(box->Count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                DestroyBox(box);
+            }
+#endif
+        }
+
+#ifndef DYNOBJECTS_INTRUSIVE_REFCOUNT
+        /**
+         * Destroys a box without references
+         * @param box Shared object box
+         */
+        static void DestroyBox(Box *box);
+#endif
+
+        /**
+         * Orders values of different kinds, booleans and objects
+         * @param o Value to compare with
+         * @return Ordering of the value relative to o
+         */
+        Ordering CompareOther(const Value &o) const;
+
+        /// Class attributes
+
+        /**
+         * Value bits masks and tags
+         */
+        static const uint64_t TagMask = 0xffff000000000000ULL;
+        static const uint64_t PayloadMask = 0x0000ffffffffffffULL;
+        static const uint64_t CanonicalNaN = 0x7ff8000000000000ULL;
+        static const uint64_t NullBits = 0xfff9000000000000ULL;
+        static const uint64_t BooleanTag = 0xfffa000000000000ULL;
+        static const uint64_t IntegerTag = 0xfffb000000000000ULL;
+        static const uint64_t ObjectTag = 0xfffc000000000000ULL;
+
+        /**
+         * Value bits
+         */
+        uint64_t m_Bits;
+    };
+
+    /**
+     * Value arithmetic
+     * @note Integers stay integers unless the result overflows 32 bits,
+     * mixed operands give doubles
+     * @throw std::bad_cast If an operand is not a number
+     */
+    inline Value operator+(const Value &a, const Value &b)
+    {
+        if(a.IsInteger() && b.IsInteger())
+        {
+            return Value::FromInteger(static_cast<int64_t>(a.AsInteger()) +
+                                      b.AsInteger());
+        }
+
+        return Value(a.AsNumber() + b.AsNumber());
+    }
+
+    inline Value operator-(const Value &a, const Value &b)
+    {
+        if(a.IsInteger() && b.IsInteger())
+        {
+            return Value::FromInteger(static_cast<int64_t>(a.AsInteger()) -
+                                      b.AsInteger());
+        }
+
+        return Value(a.AsNumber() - b.AsNumber());
+    }
+
+    inline Value operator*(const Value &a, const Value &b)
+    {
+        if(a.IsInteger() && b.IsInteger())
+        {
+            return Value::FromInteger(static_cast<int64_t>(a.AsInteger()) *
+                                      b.AsInteger());
+        }
+
+        return Value(a.AsNumber() * b.AsNumber());
+    }
+
+    /**
+     * Division, integers divide to integers only when exact
+     */
+    inline Value operator/(const Value &a, const Value &b)
+    {
+        if(a.IsInteger() && b.IsInteger())
+        {
+            int64_t dividend = a.AsInteger();
+            int64_t divisor = b.AsInteger();
+
+            if(divisor && dividend % divisor == 0)
+            {
+                return Value::FromInteger(dividend / divisor);
+            }
+        }
+
+        return Value(a.AsNumber() / b.AsNumber());
+    }
+
+    inline Value operator-(const Value &a)
+    {
+        if(a.IsInteger())
+        {
+            return Value::FromInteger(-static_cast<int64_t>(a.AsInteger()));
+        }
+
+        return Value(-a.AsDouble());
+    }
+
+    /**
+     * Stream operator for values
+     * @param os Output stream
+     * @param item Value to write to the stream
+     * @return Modified stream
+     */
+    std::ostream &operator<<(std::ostream &os, const Value &item);
+}
+
+
+// Hash implementation
+namespace std
+{
+    template<>
+    struct hash<DynObjects::Value>
+    {
+        size_t operator()(const DynObjects::Value &__v) const noexcept
+        {
+            return __v.hash();
+        }
+    };
+}
+
+#endif /* DYNOBJECTS_VALUE_H */
+
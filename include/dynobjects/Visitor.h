@@ -0,0 +1,437 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   Visitor.h
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 23:45
+ */
+
+#ifndef DYNOBJECTS_VISITOR_H
+#define DYNOBJECTS_VISITOR_H
+
+/// Internal libs includes
+#include "BasicTypes.h"
+#include "ImmutableString.h"
+#include "Object.h"
+#include "Standard.h"
+#include "TypeRegistry.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <typeinfo>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+/**
+ * DynObjects library namespace
+ */
+namespace DynObjects
+{
+    /**
+     * List of dynamic types a visitor dispatches on
+     */
+    template<typename... _Types>
+    struct TypeList
+    {
+        /**
+         * The same list with more types, such as user types
+         */
+        template<typename... _More>
+        using With = TypeList<_Types..., _More...>;
+    };
+
+    /**
+     * Dynamic types of the basic types and standard containers aliases
+     */
+    typedef TypeList<
+        Char::object_type, Short::object_type, Integer::object_type,
+        Long::object_type, Int8::object_type, Int16::object_type,
+        Int32::object_type, Int64::object_type, UChar::object_type,
+        UShort::object_type, UInteger::object_type, ULong::object_type,
+        UInt8::object_type, UInt16::object_type, UInt32::object_type,
+        UInt64::object_type, Boolean::object_type, Float::object_type,
+        Double::object_type, String::object_type, WString::object_type,
+        Text::object_type, WText::object_type,
+        Vector<ObjectPtr>::object_type, List<ObjectPtr>::object_type,
+        Set<ObjectPtr>::object_type, Map<ObjectPtr, ObjectPtr>::object_type,
+        Dictionary::object_type, NodeDictionary::object_type> StandardTypes;
+
+    /**
+     * Visitor built from several function objects, see Overload
+     */
+    template<typename _F, typename... _Fs>
+    struct Overloaded : public _F, public Overloaded<_Fs...>
+    {
+        Overloaded(_F f, _Fs... fs) :
+        _F(std::move(f)), Overloaded<_Fs...>(std::move(fs)...)
+        {
+        }
+
+        using _F::operator();
+        using Overloaded<_Fs...>::operator();
+    };
+
+    template<typename _F>
+    struct Overloaded<_F> : public _F
+    {
+        Overloaded(_F f) : _F(std::move(f))
+        {
+        }
+
+        using _F::operator();
+    };
+
+    /**
+     * Builds a visitor out of several function objects
+     * @param fs Function objects, usually lambdas
+     * @return Visitor with the call operators of all of them
+     */
+    template<typename... _Fs>
+    inline Overloaded<typename std::decay<_Fs>::type...> Overload(
+        _Fs&&... fs)
+    {
+        return Overloaded<typename std::decay<_Fs>::type...>(
+            std::forward<_Fs>(fs)...);
+    }
+
+    /**
+     * Visitor dispatch internals
+     */
+    namespace Dispatch
+    {
+        /**
+         * Item a visitor gets for an object of a dynamic type
+         */
+        template<typename _Type>
+        using ItemOf = typename std::decay<
+            decltype(*std::declval<const _Type &>())>::type;
+
+        /**
+         * Argument converting only to its own type, so a visitor taking an
+         * int is not taken for booleans or characters
+         */
+        template<typename T>
+        struct Exact
+        {
+            template<typename U, typename std::enable_if<std::is_same<
+                typename std::remove_cv<U>::type, T>::value, int>::type = 0>
+            operator U &() const;
+        };
+
+        /**
+         * Whether or not a visitor can be called with some arguments
+         */
+        template<typename _Visitor, typename... Args>
+        struct IsCallable
+        {
+            template<typename V, typename = decltype(
+                std::declval<V &>()(std::declval<Args>()...))>
+            static std::true_type Test(int);
+
+            template<typename V>
+            static std::false_type Test(...);
+
+            typedef decltype(Test<_Visitor>(0)) type;
+        };
+
+        /**
+         * Result of a visitor, the one of its overload for any object
+         */
+        template<bool _Fallback, typename _Visitor, typename... Args>
+        struct ResultOfImpl
+        {
+            typedef void type;
+        };
+
+        template<typename _Visitor, typename... Args>
+        struct ResultOfImpl<true, _Visitor, Args...>
+        {
+            typedef decltype(std::declval<_Visitor &>()(
+                std::declval<Args>()...)) type;
+        };
+
+        template<typename _Visitor, typename... Args>
+        using ResultOf = typename ResultOfImpl<
+            IsCallable<_Visitor, Args...>::type::value, _Visitor,
+            Args...>::type;
+
+        /**
+         * Calls the overload of a visitor for any object
+         * @throw std::bad_cast If the visitor has no such overload
+         */
+        template<typename R, typename _Visitor, typename... Args>
+        inline R Otherwise(std::true_type, _Visitor &visitor,
+                           const Args &... objects)
+        {
+            return static_cast<R>(visitor(objects...));
+        }
+
+        template<typename R, typename _Visitor, typename... Args>
+        inline R Otherwise(std::false_type, _Visitor &, const Args &...)
+        {
+            throw std::bad_cast();
+        }
+
+        /**
+         * Jump table over the type identifiers of a list of types
+         * @note Built on first use, type identifiers missing from the list
+         * lead to the fallback entry of the maker
+         */
+        template<typename _Maker, typename _List>
+        class Table;
+
+        template<typename _Maker, typename... _Types>
+        class Table<_Maker, TypeList<_Types...>>
+        {
+        public:
+            typedef typename _Maker::Entry Entry;
+
+            /**
+             * Finds the entry of a type
+             * @param id Type identifier
+             * @return Table entry
+             */
+            static inline Entry Find(TypeId id)
+            {
+                static const Table table;
+
+                if(id < table.m_Entries.size())
+                {
+                    return table.m_Entries[id];
+                }
+
+                return &_Maker::Fallback;
+            }
+
+        private:
+            /**
+             * Class constructor, fills the table
+             */
+            Table()
+            {
+                const std::vector<TypeId> ids = {GetTypeId<_Types>()...};
+                const std::vector<Entry> entries = {
+                    _Maker::template Get<_Types>()...};
+
+                for(size_t i = 0; i < ids.size(); ++i)
+                {
+                    if(ids[i] >= this->m_Entries.size())
+                    {
+                        this->m_Entries.resize(ids[i] + 1, &_Maker::Fallback);
+                    }
+
+                    this->m_Entries[ids[i]] = entries[i];
+                }
+            }
+
+            /**
+             * Entries, by type identifier
+             */
+            std::vector<Entry> m_Entries;
+        };
+
+        /**
+         * Entries of single dispatch tables
+         */
+        template<typename R, typename _Visitor>
+        struct Unary
+        {
+            typedef R (*Entry)(const Object &, _Visitor &);
+
+            template<typename _Type>
+            static inline Entry Get()
+            {
+                return &Call<_Type>;
+            }
+
+            static R Fallback(const Object &o, _Visitor &visitor)
+            {
+                return Otherwise<R>(typename IsCallable<_Visitor,
+                    const Object &>::type(), visitor, o);
+            }
+
+            template<typename _Type>
+            static R Call(const Object &o, _Visitor &visitor)
+            {
+                return Invoke(static_cast<const _Type &>(o), visitor,
+                              typename IsCallable<_Visitor,
+                                  Exact<ItemOf<_Type>>>::type());
+            }
+
+            template<typename _Type>
+            static inline R Invoke(const _Type &o, _Visitor &visitor,
+                                   std::true_type)
+            {
+                return static_cast<R>(visitor(*o));
+            }
+
+            template<typename _Type>
+            static inline R Invoke(const _Type &o, _Visitor &visitor,
+                                   std::false_type)
+            {
+                return Fallback(o, visitor);
+            }
+        };
+
+        /**
+         * Entries of double dispatch tables, the first object picks the
+         * table of the second one
+         */
+        template<typename R, typename _Visitor, typename _List>
+        struct Binary
+        {
+            typedef R (*Entry)(const Object &, const Object &, _Visitor &);
+
+            template<typename _Type>
+            static inline Entry Get()
+            {
+                return &First<_Type>;
+            }
+
+            static R Fallback(const Object &a, const Object &b,
+                              _Visitor &visitor)
+            {
+                return Otherwise<R>(typename IsCallable<_Visitor,
+                    const Object &, const Object &>::type(), visitor, a, b);
+            }
+
+            template<typename _First>
+            static R First(const Object &a, const Object &b,
+                           _Visitor &visitor)
+            {
+                return Table<Second<_First>, _List>::Find(
+                    b.GetObjectTypeId())(a, b, visitor);
+            }
+
+            template<typename _First>
+            struct Second
+            {
+                typedef typename Binary::Entry Entry;
+
+                template<typename _Type>
+                static inline Entry Get()
+                {
+                    return &Call<_Type>;
+                }
+
+                static R Fallback(const Object &a, const Object &b,
+                                  _Visitor &visitor)
+                {
+                    return Binary::Fallback(a, b, visitor);
+                }
+
+                template<typename _Type>
+                static R Call(const Object &a, const Object &b,
+                              _Visitor &visitor)
+                {
+                    return Invoke(static_cast<const _First &>(a),
+                                  static_cast<const _Type &>(b), visitor,
+                                  typename IsCallable<_Visitor,
+                                      Exact<ItemOf<_First>>,
+                                      Exact<ItemOf<_Type>>>::type());
+                }
+
+                template<typename _Type>
+                static inline R Invoke(const _First &a, const _Type &b,
+                                       _Visitor &visitor, std::true_type)
+                {
+                    return static_cast<R>(visitor(*a, *b));
+                }
+
+                template<typename _Type>
+                static inline R Invoke(const _First &a, const _Type &b,
+                                       _Visitor &visitor, std::false_type)
+                {
+                    return Fallback(a, b, visitor);
+                }
+            };
+        };
+    }
+
+    /**
+     * Calls the overload of a visitor for the dynamic type of an object
+     * @param ref Object pointer or reference, not null
+     * @param visitor Visitor, see Overload. It is called with the item of
+     * the object, such as an int for Integer or a std::string for String,
+     * if it takes exactly that type, or with the object as a const Object
+     * reference otherwise. Its result is the one of that last overload, or
+     * void if it has none
+     * @return Result of the visitor
+     * @throw std::bad_cast If the pointer is null or the visitor has no
+     * overload for the object
+     * @note _List gives the types the visitor may take the item of,
+     * StandardTypes by default, add user types with StandardTypes::With.
+     * Dispatching is a single indirect call through a table indexed by
+     * type identifier
+     */
+    template<typename _List = StandardTypes, typename _Visitor>
+    inline Dispatch::ResultOf<typename std::remove_reference<_Visitor>::type,
+        const Object &> Visit(const ObjectRef &ref, _Visitor &&visitor)
+    {
+        typedef typename std::remove_reference<_Visitor>::type _V;
+        typedef Dispatch::Unary<Dispatch::ResultOf<_V, const Object &>, _V>
+            _Unary;
+
+        if(!ref)
+        {
+            throw std::bad_cast();
+        }
+
+        const Object &o = *ref;
+        return Dispatch::Table<_Unary, _List>::Find(o.GetObjectTypeId())(o,
+            visitor);
+    }
+
+    /**
+     * Calls the overload of a visitor for the dynamic types of two objects
+     * @param a Object pointer or reference, not null
+     * @param b Object pointer or reference, not null
+     * @param visitor Visitor, see Overload. It is called with the items of
+     * both objects if it takes exactly those types, or with both objects as
+     * const Object references otherwise
+     * @return Result of the visitor
+     * @throw std::bad_cast If a pointer is null or the visitor has no
+     * overload for the objects
+     * @note See the single object Visit. Dispatching is two indirect calls
+     */
+    template<typename _List = StandardTypes, typename _Visitor>
+    inline Dispatch::ResultOf<typename std::remove_reference<_Visitor>::type,
+        const Object &, const Object &> Visit(const ObjectRef &a,
+        const ObjectRef &b, _Visitor &&visitor)
+    {
+        typedef typename std::remove_reference<_Visitor>::type _V;
+        typedef Dispatch::Binary<Dispatch::ResultOf<_V, const Object &,
+            const Object &>, _V, _List> _Binary;
+
+        if(!a || !b)
+        {
+            throw std::bad_cast();
+        }
+
+        const Object &first = *a;
+        return Dispatch::Table<_Binary, _List>::Find(
+            first.GetObjectTypeId())(first, *b, visitor);
+    }
+}
+
+#endif /* DYNOBJECTS_VISITOR_H */
+
@@ -0,0 +1,520 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/// Internal libs includes
+#include "dynobjects/Allocator.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+
+namespace
+{
+    /**
+     * Chunk size and alignment, blocks find their chunk header by masking
+     */
+    const size_t ChunkSize = 64 * 1024;
+
+    /**
+     * Block size granularity
+     */
+    const size_t Granularity = 16;
+
+    /**
+     * Number of size classes
+     */
+    const size_t ClassCount = DynObjects::Allocator::MaxBlockSize / Granularity;
+
+    /**
+     * Number of blocks moved at once between thread caches and the depot
+     */
+    const size_t BatchSize = 64;
+
+    /**
+     * Maximum number of free blocks a thread cache keeps per size class
+     */
+    const size_t MaxCached = 4 * BatchSize;
+
+    /**
+     * Maximum number of arena chunks a thread keeps for later arenas
+     */
+    const size_t MaxSpareChunks = 8;
+
+    /**
+     * Chunk kinds
+     */
+    enum ChunkKind : uint32_t
+    {
+        PoolChunk = 0x504f4f4c,
+        ArenaChunk = 0x4152454e
+    };
+
+    /**
+     * Chunk header, at the start of every chunk
+     */
+    struct alignas(16) ChunkHeader
+    {
+        /**
+         * Chunk kind
+         */
+        ChunkKind Kind;
+
+        /**
+         * Next chunk of the owning arena
+         */
+        ChunkHeader *Next;
+    };
+
+    /**
+     * Free block, linked through its first bytes
+     */
+    struct FreeBlock
+    {
+        FreeBlock *Next;
+    };
+
+    /**
+     * Allocates an aligned chunk
+     * @param kind Chunk kind
+     * @return Chunk header
+     * @throw std::bad_alloc If there is no memory available
+     */
+    ChunkHeader *AllocateChunk(ChunkKind kind)
+    {
+        void *memory = nullptr;
+        if(posix_memalign(&memory, ChunkSize, ChunkSize) != 0)
+        {
+            throw std::bad_alloc();
+        }
+
+        ChunkHeader *header = static_cast<ChunkHeader *>(memory);
+        header->Kind = kind;
+        header->Next = nullptr;
+        return header;
+    }
+
+    /**
+     * Returns the header of the chunk holding a block
+     * @param ptr Pointer to the block
+     * @return Chunk header
+     */
+    inline ChunkHeader *GetChunk(void *ptr)
+    {
+        return reinterpret_cast<ChunkHeader *>(
+            reinterpret_cast<uintptr_t>(ptr) & ~uintptr_t(ChunkSize - 1));
+    }
+
+    /**
+     * Returns the size class of a block size
+     * @param size Block size
+     * @return Size class index
+     */
+    inline size_t GetClass(size_t size)
+    {
+        return size ? (size - 1) / Granularity : 0;
+    }
+
+    /**
+     * Free blocks of one size class shared by every thread
+     */
+    struct Depot
+    {
+        std::mutex Mutex;
+        FreeBlock *Head = nullptr;
+        size_t Count = 0;
+    };
+
+    /**
+     * Returns the depots, never destroyed so objects released during
+     * static destruction still find them
+     * @return Depot of each size class
+     */
+    Depot *GetDepots()
+    {
+        static Depot *depots = new Depot[ClassCount];
+        return depots;
+    }
+
+    /**
+     * Free blocks of one size class owned by one thread
+     */
+    struct Cache
+    {
+        /**
+         * Free blocks
+         */
+        FreeBlock *Head = nullptr;
+
+        /**
+         * Number of free blocks
+         */
+        size_t Count = 0;
+
+        /**
+         * Unused range of the current chunk
+         */
+        char *Next = nullptr;
+        char *End = nullptr;
+    };
+
+    /**
+     * Moves up to count blocks from a list to a depot
+     * @param depot Destination depot
+     * @param head List head, updated
+     * @param count Maximum number of blocks moved
+     * @return Number of blocks moved
+     */
+    size_t Flush(Depot &depot, FreeBlock *&head, size_t count)
+    {
+        if(head == nullptr || count == 0)
+        {
+            return 0;
+        }
+
+        FreeBlock *first = head;
+        FreeBlock *last = head;
+        size_t moved = 1;
+
+        while(moved < count && last->Next != nullptr)
+        {
+            last = last->Next;
+            ++moved;
+        }
+
+        head = last->Next;
+
+        std::lock_guard<std::mutex> lock(depot.Mutex);
+        last->Next = depot.Head;
+        depot.Head = first;
+        depot.Count += moved;
+
+        return moved;
+    }
+
+    /**
+     * Thread cache, returns its blocks to the depots when the thread exits
+     */
+    struct ThreadCache
+    {
+        /**
+         * Free blocks of each size class
+         */
+        Cache Classes[ClassCount];
+
+        /**
+         * Arena chunks released by finished arenas
+         */
+        ChunkHeader *SpareChunks = nullptr;
+
+        /**
+         * Number of spare arena chunks
+         */
+        size_t SpareCount = 0;
+
+        ~ThreadCache();
+    };
+
+    /**
+     * Whether the cache of the current thread was already destroyed
+     */
+    thread_local bool t_CacheDestroyed = false;
+
+    /**
+     * Cache of the current thread
+     */
+    thread_local ThreadCache t_Cache;
+
+    /**
+     * Innermost arena of the current thread
+     */
+    thread_local DynObjects::ArenaScope *t_Arena = nullptr;
+
+    ThreadCache::~ThreadCache()
+    {
+        Depot *depots = GetDepots();
+
+        for(size_t i = 0; i < ClassCount; ++i)
+        {
+            Cache &cache = this->Classes[i];
+            size_t size = (i + 1) * Granularity;
+
+            while(cache.Next + size <= cache.End)
+            {
+                FreeBlock *block = reinterpret_cast<FreeBlock *>(cache.Next);
+                block->Next = cache.Head;
+                cache.Head = block;
+                cache.Next += size;
+            }
+
+            Flush(depots[i], cache.Head, SIZE_MAX);
+        }
+
+        while(this->SpareChunks != nullptr)
+        {
+            ChunkHeader *next = this->SpareChunks->Next;
+            free(this->SpareChunks);
+            this->SpareChunks = next;
+        }
+
+        t_CacheDestroyed = true;
+    }
+
+    /**
+     * Acquires an arena chunk, reusing the spare ones of the thread
+     * @return Chunk header
+     */
+    ChunkHeader *AcquireArenaChunk()
+    {
+        if(!t_CacheDestroyed && t_Cache.SpareChunks != nullptr)
+        {
+            ChunkHeader *chunk = t_Cache.SpareChunks;
+            t_Cache.SpareChunks = chunk->Next;
+            --t_Cache.SpareCount;
+
+            chunk->Next = nullptr;
+            return chunk;
+        }
+
+        return AllocateChunk(ArenaChunk);
+    }
+
+    /**
+     * Releases an arena chunk, keeping a few of them for later arenas
+     * @param chunk Chunk header
+     */
+    void ReleaseArenaChunk(ChunkHeader *chunk)
+    {
+        if(!t_CacheDestroyed && t_Cache.SpareCount < MaxSpareChunks)
+        {
+            chunk->Next = t_Cache.SpareChunks;
+            t_Cache.SpareChunks = chunk;
+            ++t_Cache.SpareCount;
+        }
+        else
+        {
+            free(chunk);
+        }
+    }
+
+    /**
+     * Allocates a pool block
+     * @param index Size class index
+     * @return Pointer to the block
+     */
+    void *AllocateBlock(size_t index)
+    {
+        Depot &depot = GetDepots()[index];
+
+        if(t_CacheDestroyed)
+        {
+            {
+                std::lock_guard<std::mutex> lock(depot.Mutex);
+                if(depot.Head != nullptr)
+                {
+                    FreeBlock *block = depot.Head;
+                    depot.Head = block->Next;
+                    --depot.Count;
+                    return block;
+                }
+            }
+
+            size_t size = (index + 1) * Granularity;
+            char *chunk = reinterpret_cast<char *>(AllocateChunk(PoolChunk));
+            char *first = chunk + sizeof(ChunkHeader);
+            FreeBlock *head = nullptr;
+
+            for(char *next = first + size; next + size <= chunk + ChunkSize;
+                next += size)
+            {
+                FreeBlock *block = reinterpret_cast<FreeBlock *>(next);
+                block->Next = head;
+                head = block;
+            }
+
+            Flush(depot, head, SIZE_MAX);
+            return first;
+        }
+
+        Cache &cache = t_Cache.Classes[index];
+
+        if(cache.Head == nullptr)
+        {
+            std::lock_guard<std::mutex> lock(depot.Mutex);
+            for(size_t i = 0; i < BatchSize && depot.Head != nullptr; ++i)
+            {
+                FreeBlock *block = depot.Head;
+                depot.Head = block->Next;
+                --depot.Count;
+
+                block->Next = cache.Head;
+                cache.Head = block;
+                ++cache.Count;
+            }
+        }
+
+        if(cache.Head != nullptr)
+        {
+            FreeBlock *block = cache.Head;
+            cache.Head = block->Next;
+            --cache.Count;
+            return block;
+        }
+
+        size_t size = (index + 1) * Granularity;
+
+        if(cache.Next + size > cache.End)
+        {
+            char *chunk = reinterpret_cast<char *>(AllocateChunk(PoolChunk));
+            cache.Next = chunk + sizeof(ChunkHeader);
+            cache.End = chunk + ChunkSize;
+        }
+
+        void *block = cache.Next;
+        cache.Next += size;
+        return block;
+    }
+
+    /**
+     * Deallocates a pool block
+     * @param ptr Pointer to the block
+     * @param index Size class index
+     */
+    void DeallocateBlock(void *ptr, size_t index)
+    {
+        FreeBlock *block = static_cast<FreeBlock *>(ptr);
+        Depot &depot = GetDepots()[index];
+
+        if(t_CacheDestroyed)
+        {
+            block->Next = nullptr;
+            Flush(depot, block, 1);
+            return;
+        }
+
+        Cache &cache = t_Cache.Classes[index];
+
+        block->Next = cache.Head;
+        cache.Head = block;
+
+        if(++cache.Count > MaxCached)
+        {
+            cache.Count -= Flush(depot, cache.Head, BatchSize);
+        }
+    }
+}
+
+#ifdef DYNOBJECTS_POOL_ALLOCATOR
+
+void *DynObjects::Allocator::Allocate(size_t size)
+{
+    if(size > MaxBlockSize)
+    {
+        return ::operator new(size);
+    }
+
+    if(t_Arena != nullptr)
+    {
+        return t_Arena->Allocate(size);
+    }
+
+    return AllocateBlock(GetClass(size));
+}
+
+void DynObjects::Allocator::Deallocate(void *ptr, size_t size)
+{
+    if(ptr == nullptr)
+    {
+        return;
+    }
+
+    if(size > MaxBlockSize)
+    {
+        ::operator delete(ptr);
+    }
+    else if(GetChunk(ptr)->Kind == PoolChunk)
+    {
+        DeallocateBlock(ptr, GetClass(size));
+    }
+}
+
+#else
+
+void *DynObjects::Allocator::Allocate(size_t size)
+{
+    return ::operator new(size);
+}
+
+void DynObjects::Allocator::Deallocate(void *ptr, size_t)
+{
+    ::operator delete(ptr);
+}
+
+#endif
+
+DynObjects::ArenaScope::ArenaScope() :
+m_Previous(t_Arena), m_Chunks(nullptr), m_Next(nullptr), m_End(nullptr),
+m_Size(0)
+{
+    t_Arena = this;
+}
+
+DynObjects::ArenaScope::~ArenaScope()
+{
+    ChunkHeader *chunk = static_cast<ChunkHeader *>(this->m_Chunks);
+
+    while(chunk != nullptr)
+    {
+        ChunkHeader *next = chunk->Next;
+        ReleaseArenaChunk(chunk);
+        chunk = next;
+    }
+
+    t_Arena = this->m_Previous;
+}
+
+void *DynObjects::ArenaScope::Allocate(size_t size)
+{
+    size = (size + Granularity - 1) & ~(Granularity - 1);
+
+    if(size > ChunkSize - sizeof(ChunkHeader))
+    {
+        throw std::bad_alloc();
+    }
+
+    if(this->m_Next + size > this->m_End)
+    {
+        ChunkHeader *chunk = AcquireArenaChunk();
+        chunk->Next = static_cast<ChunkHeader *>(this->m_Chunks);
+        this->m_Chunks = chunk;
+
+        this->m_Next = reinterpret_cast<char *>(chunk) + sizeof(ChunkHeader);
+        this->m_End = reinterpret_cast<char *>(chunk) + ChunkSize;
+    }
+
+    void *block = this->m_Next;
+    this->m_Next += size;
+    this->m_Size += size;
+    return block;
+}
+
+DynObjects::ArenaScope *DynObjects::ArenaScope::GetCurrent()
+{
+    return t_Arena;
+}
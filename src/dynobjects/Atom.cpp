@@ -0,0 +1,259 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/// Internal libs includes
+#include "dynobjects/Atom.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+    typedef DynObjects::Symbol::Entry Entry;
+
+    /**
+     * Number of intern table shards, a power of two
+     */
+    const size_t ShardCount = 64;
+
+    /**
+     * Initial number of slots of a shard, a power of two
+     */
+    const size_t InitialSlots = 64;
+
+    /**
+     * Slots of one shard, open addressing with linear probing
+     * @note Insert-only: a slot is written once, from null to its entry
+     */
+    struct Slots
+    {
+        /**
+         * Number of slots minus one
+         */
+        size_t Mask;
+
+        /**
+         * Slots, null while free
+         */
+        std::atomic<const Entry *> *Items;
+
+        explicit Slots(size_t size) : Mask(size - 1),
+        Items(new std::atomic<const Entry *>[size]())
+        {
+        }
+    };
+
+    /**
+     * Intern table shard
+     * @note Readers probe the current slots without locking, writers lock
+     * the shard. Slots replaced by bigger ones are kept, readers may still
+     * be probing them
+     */
+    struct Shard
+    {
+        /**
+         * Serializes insertions
+         */
+        std::mutex Mutex;
+
+        /**
+         * Current slots
+         */
+        std::atomic<const Slots *> Current;
+
+        /**
+         * Every slots array replaced by a bigger one
+         */
+        std::vector<const Slots *> Retired;
+
+        /**
+         * Number of entries
+         */
+        std::atomic<size_t> Count;
+
+        Shard() : Current(new Slots(InitialSlots)), Count(0)
+        {
+        }
+    };
+
+    /**
+     * Returns the intern table, never destroyed so symbols stay valid
+     * during static destruction
+     * @return Intern table shards
+     */
+    Shard *GetShards()
+    {
+        static Shard *shards = new Shard[ShardCount];
+        return shards;
+    }
+
+    /**
+     * Returns the shard of a hash, from its high bits, the slots use the
+     * low ones
+     * @param hash Hash of a name
+     * @return Shard
+     */
+    inline Shard &GetShard(size_t hash)
+    {
+        return GetShards()[(hash >> (sizeof(size_t) * 8 - 6)) &
+            (ShardCount - 1)];
+    }
+
+    /**
+     * Looks a name up in a slots array
+     * @param slots Slots to probe
+     * @param name Symbol name
+     * @param hash Hash of the name
+     * @return Entry of the name, or null if there is none
+     */
+    const Entry *Lookup(const Slots &slots, const std::string &name,
+                        size_t hash)
+    {
+        for(size_t i = hash & slots.Mask; ; i = (i + 1) & slots.Mask)
+        {
+            const Entry *entry =
+                slots.Items[i].load(std::memory_order_acquire);
+
+            if(entry == nullptr)
+            {
+                return nullptr;
+            }
+
+            if(entry->Hash == hash && entry->Name == name)
+            {
+                return entry;
+            }
+        }
+    }
+
+    /**
+     * Stores an entry in the first free slot of its probe sequence
+     * @param slots Slots, with at least one free slot
+     * @param entry Entry to store
+     */
+    void Store(const Slots &slots, const Entry *entry)
+    {
+        size_t i = entry->Hash & slots.Mask;
+
+        while(slots.Items[i].load(std::memory_order_relaxed) != nullptr)
+        {
+            i = (i + 1) & slots.Mask;
+        }
+
+        slots.Items[i].store(entry, std::memory_order_release);
+    }
+
+    /**
+     * Hashes a symbol name
+     * @param name Symbol name
+     * @return Hash of the name, as the one of the string holding it
+     */
+    inline size_t HashName(const std::string &name)
+    {
+        return DynObjects::Operators::Hash<std::string>()(name);
+    }
+}
+
+DynObjects::Symbol::Symbol() : m_Entry(nullptr)
+{
+    static const Entry *empty = Intern(std::string());
+    this->m_Entry = empty;
+}
+
+const DynObjects::Symbol::Entry *DynObjects::Symbol::Intern(
+    const std::string &name)
+{
+    size_t hash = HashName(name);
+    Shard &shard = GetShard(hash);
+
+    const Entry *entry = Lookup(
+        *shard.Current.load(std::memory_order_acquire), name, hash);
+
+    if(entry != nullptr)
+    {
+        return entry;
+    }
+
+    std::lock_guard<std::mutex> lock(shard.Mutex);
+    const Slots *slots = shard.Current.load(std::memory_order_relaxed);
+
+    entry = Lookup(*slots, name, hash);
+    if(entry != nullptr)
+    {
+        return entry;
+    }
+
+    size_t count = shard.Count.load(std::memory_order_relaxed);
+
+    // Keep the load factor at one half at most
+    if(2 * (count + 1) > slots->Mask + 1)
+    {
+        const Slots *grown = new Slots(2 * (slots->Mask + 1));
+
+        for(size_t i = 0; i <= slots->Mask; ++i)
+        {
+            const Entry *item =
+                slots->Items[i].load(std::memory_order_relaxed);
+
+            if(item != nullptr)
+            {
+                Store(*grown, item);
+            }
+        }
+
+        shard.Retired.push_back(slots);
+        shard.Current.store(grown, std::memory_order_release);
+        slots = grown;
+    }
+
+    entry = new Entry{hash, name};
+    Store(*slots, entry);
+    shard.Count.store(count + 1, std::memory_order_relaxed);
+
+    return entry;
+}
+
+bool DynObjects::Symbol::Find(const std::string &name, Symbol &symbol)
+{
+    size_t hash = HashName(name);
+    const Entry *entry = Lookup(
+        *GetShard(hash).Current.load(std::memory_order_acquire), name, hash);
+
+    if(entry != nullptr)
+    {
+        symbol = Symbol(entry);
+    }
+
+    return entry != nullptr;
+}
+
+size_t DynObjects::Symbol::GetCount()
+{
+    Shard *shards = GetShards();
+    size_t count = 0;
+
+    for(size_t i = 0; i < ShardCount; ++i)
+    {
+        count += shards[i].Count.load(std::memory_order_relaxed);
+    }
+
+    return count;
+}
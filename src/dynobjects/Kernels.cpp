@@ -0,0 +1,632 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/// Internal libs includes
+#include "dynobjects/Kernels.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+// x86 intrinsics
+#if defined(DYNOBJECTS_SIMD_KERNELS) && defined(__GNUC__) && \
+    (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#define DYNOBJECTS_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace
+{
+    using DynObjects::Kernels::Level;
+
+    /**
+     * Bytes hashed per block step, one 64 bits lane per accumulator
+     */
+    const size_t StripeSize = 32;
+
+    /**
+     * Lane keys
+     */
+    const uint64_t Keys[4] =
+    {
+        0x9e3779b185ebca87ULL, 0xc2b2ae3d27d4eb4fULL,
+        0x165667b19e3779f9ULL, 0x85ebca77c2b2ae63ULL
+    };
+
+    /**
+     * Lane rotation applied before every stripe, makes the hash depend on
+     * the order of the stripes
+     */
+    const int Rotation = 23;
+
+    /**
+     * Lane normalizations, zeros of both signs have the same bits once
+     * normalized
+     */
+    enum Normalization
+    {
+        Bytes,
+        Floats,
+        Doubles
+    };
+
+    /**
+     * Murmur3 finalizer
+     * @param hash Hash to mix
+     * @return Mixed hash
+     */
+    inline uint64_t Mix(uint64_t hash)
+    {
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdULL;
+        hash ^= hash >> 33;
+        hash *= 0xc4ceb9fe1a85ec53ULL;
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+    /**
+     * Folds the accumulators into the final hash
+     * @param acc Accumulators
+     * @param size Number of bytes hashed
+     * @return Hash of the bytes
+     */
+    inline size_t Finalize(const uint64_t acc[4], size_t size)
+    {
+        const uint64_t m = 0xc6a4a7935bd1e995ULL;
+        uint64_t hash = size * m;
+
+        for(size_t i = 0; i < 4; ++i)
+        {
+            hash ^= Mix(acc[i]);
+            hash *= m;
+        }
+
+        return static_cast<size_t>(Mix(hash));
+    }
+
+    /**
+     * Loads and normalizes a scalar lane
+     * @param ptr Pointer to the lane
+     * @return Lane bits
+     */
+    template<Normalization _Norm>
+    inline uint64_t LoadLane(const unsigned char *ptr)
+    {
+        uint64_t lane;
+        std::memcpy(&lane, ptr, sizeof(lane));
+
+        if(_Norm == Floats)
+        {
+            float items[2];
+            std::memcpy(items, &lane, sizeof(items));
+            items[0] = items[0] == 0.0f ? 0.0f : items[0];
+            items[1] = items[1] == 0.0f ? 0.0f : items[1];
+            std::memcpy(&lane, items, sizeof(items));
+        }
+        else if(_Norm == Doubles)
+        {
+            double item;
+            std::memcpy(&item, &lane, sizeof(item));
+            item = item == 0.0 ? 0.0 : item;
+            std::memcpy(&lane, &item, sizeof(item));
+        }
+
+        return lane;
+    }
+
+    /**
+     * Scalar block hash
+     * @param data Pointer to the first byte
+     * @param size Number of bytes, at least StripeSize
+     * @return Hash of the bytes
+     * @note Reference implementation, every other one gives its results
+     */
+    template<Normalization _Norm>
+    size_t HashBlocksScalar(const void *data, size_t size)
+    {
+        const unsigned char *bytes = static_cast<const unsigned char *>(data);
+        uint64_t acc[4] = {Keys[0], Keys[1], Keys[2], Keys[3]};
+
+        // Full stripes, then the last one overlapping the previous ones
+        for(size_t offset = 0; ; offset += StripeSize)
+        {
+            const unsigned char *stripe = offset + StripeSize < size ?
+                bytes + offset : bytes + size - StripeSize;
+
+            for(size_t i = 0; i < 4; ++i)
+            {
+                uint64_t lane = LoadLane<_Norm>(stripe + i * 8);
+                uint64_t keyed = lane ^ Keys[i];
+
+                acc[i] = (acc[i] << Rotation | acc[i] >> (64 - Rotation)) +
+                    (keyed & 0xffffffffULL) * (keyed >> 32) + lane;
+            }
+
+            if(offset + StripeSize >= size)
+            {
+                break;
+            }
+        }
+
+        return Finalize(acc, size);
+    }
+
+    /**
+     * Scalar byte mismatch
+     */
+    size_t MismatchBytesScalar(const void *a, const void *b, size_t size)
+    {
+        const unsigned char *x = static_cast<const unsigned char *>(a);
+        const unsigned char *y = static_cast<const unsigned char *>(b);
+        size_t i = 0;
+
+        for(; i + 8 <= size; i += 8)
+        {
+            uint64_t wx, wy;
+            std::memcpy(&wx, x + i, sizeof(wx));
+            std::memcpy(&wy, y + i, sizeof(wy));
+
+            if(wx != wy)
+            {
+                break;
+            }
+        }
+
+        for(; i < size && x[i] == y[i]; ++i)
+        {
+        }
+
+        return i;
+    }
+
+    /**
+     * Scalar item mismatch
+     */
+    template<typename _Tp>
+    size_t MismatchScalar(const _Tp *a, const _Tp *b, size_t size)
+    {
+        size_t i = 0;
+        for(; i < size && a[i] == b[i]; ++i)
+        {
+        }
+        return i;
+    }
+
+#ifdef DYNOBJECTS_X86_KERNELS
+    /**
+     * SSE2 lanes normalization
+     */
+    template<Normalization _Norm>
+    inline __m128i Normalize(__m128i lanes)
+    {
+        if(_Norm == Floats)
+        {
+            __m128 items = _mm_castsi128_ps(lanes);
+            return _mm_castps_si128(_mm_andnot_ps(
+                _mm_cmpeq_ps(items, _mm_setzero_ps()), items));
+        }
+        else if(_Norm == Doubles)
+        {
+            __m128d items = _mm_castsi128_pd(lanes);
+            return _mm_castpd_si128(_mm_andnot_pd(
+                _mm_cmpeq_pd(items, _mm_setzero_pd()), items));
+        }
+
+        return lanes;
+    }
+
+    /**
+     * SSE2 accumulation of two lanes
+     */
+    inline __m128i Accumulate(__m128i acc, __m128i lanes, __m128i keys)
+    {
+        __m128i keyed = _mm_xor_si128(lanes, keys);
+        __m128i product = _mm_mul_epu32(keyed, _mm_srli_epi64(keyed, 32));
+        __m128i rotated = _mm_or_si128(_mm_slli_epi64(acc, Rotation),
+                                       _mm_srli_epi64(acc, 64 - Rotation));
+
+        return _mm_add_epi64(_mm_add_epi64(rotated, product), lanes);
+    }
+
+    /**
+     * SSE2 block hash
+     */
+    template<Normalization _Norm>
+    size_t HashBlocksSSE2(const void *data, size_t size)
+    {
+        const unsigned char *bytes = static_cast<const unsigned char *>(data);
+        const __m128i keysLow = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(Keys));
+        const __m128i keysHigh = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(Keys + 2));
+        __m128i accLow = keysLow;
+        __m128i accHigh = keysHigh;
+
+        for(size_t offset = 0; ; offset += StripeSize)
+        {
+            const unsigned char *stripe = offset + StripeSize < size ?
+                bytes + offset : bytes + size - StripeSize;
+
+            accLow = Accumulate(accLow, Normalize<_Norm>(_mm_loadu_si128(
+                reinterpret_cast<const __m128i *>(stripe))), keysLow);
+            accHigh = Accumulate(accHigh, Normalize<_Norm>(_mm_loadu_si128(
+                reinterpret_cast<const __m128i *>(stripe + 16))), keysHigh);
+
+            if(offset + StripeSize >= size)
+            {
+                break;
+            }
+        }
+
+        uint64_t acc[4];
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(acc), accLow);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(acc + 2), accHigh);
+        return Finalize(acc, size);
+    }
+
+    /**
+     * SSE2 byte mismatch
+     */
+    size_t MismatchBytesSSE2(const void *a, const void *b, size_t size)
+    {
+        const unsigned char *x = static_cast<const unsigned char *>(a);
+        const unsigned char *y = static_cast<const unsigned char *>(b);
+        size_t i = 0;
+
+        for(; i + 16 <= size; i += 16)
+        {
+            int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(
+                _mm_loadu_si128(reinterpret_cast<const __m128i *>(x + i)),
+                _mm_loadu_si128(reinterpret_cast<const __m128i *>(y + i))));
+
+            if(mask != 0xffff)
+            {
+                return i + __builtin_ctz(~mask);
+            }
+        }
+
+        return i + MismatchBytesScalar(x + i, y + i, size - i);
+    }
+
+    /**
+     * SSE2 float mismatch
+     */
+    size_t MismatchFloatsSSE2(const float *a, const float *b, size_t size)
+    {
+        size_t i = 0;
+
+        for(; i + 4 <= size; i += 4)
+        {
+            int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(a + i),
+                                                    _mm_loadu_ps(b + i)));
+            if(mask != 0xf)
+            {
+                return i + __builtin_ctz(~mask);
+            }
+        }
+
+        return i + MismatchScalar(a + i, b + i, size - i);
+    }
+
+    /**
+     * SSE2 double mismatch
+     */
+    size_t MismatchDoublesSSE2(const double *a, const double *b, size_t size)
+    {
+        size_t i = 0;
+
+        for(; i + 2 <= size; i += 2)
+        {
+            int mask = _mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(a + i),
+                                                    _mm_loadu_pd(b + i)));
+            if(mask != 0x3)
+            {
+                return i + __builtin_ctz(~mask);
+            }
+        }
+
+        return i + MismatchScalar(a + i, b + i, size - i);
+    }
+
+    /**
+     * AVX2 lanes normalization
+     */
+    template<Normalization _Norm>
+    __attribute__((target("avx2")))
+    inline __m256i Normalize256(__m256i lanes)
+    {
+        if(_Norm == Floats)
+        {
+            __m256 items = _mm256_castsi256_ps(lanes);
+            return _mm256_castps_si256(_mm256_andnot_ps(_mm256_cmp_ps(
+                items, _mm256_setzero_ps(), _CMP_EQ_OQ), items));
+        }
+        else if(_Norm == Doubles)
+        {
+            __m256d items = _mm256_castsi256_pd(lanes);
+            return _mm256_castpd_si256(_mm256_andnot_pd(_mm256_cmp_pd(
+                items, _mm256_setzero_pd(), _CMP_EQ_OQ), items));
+        }
+
+        return lanes;
+    }
+
+    /**
+     * AVX2 block hash
+     */
+    template<Normalization _Norm>
+    __attribute__((target("avx2")))
+    size_t HashBlocksAVX2(const void *data, size_t size)
+    {
+        const unsigned char *bytes = static_cast<const unsigned char *>(data);
+        const __m256i keys = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i *>(Keys));
+        __m256i acc = keys;
+
+        for(size_t offset = 0; ; offset += StripeSize)
+        {
+            const unsigned char *stripe = offset + StripeSize < size ?
+                bytes + offset : bytes + size - StripeSize;
+
+            __m256i lanes = Normalize256<_Norm>(_mm256_loadu_si256(
+                reinterpret_cast<const __m256i *>(stripe)));
+            __m256i keyed = _mm256_xor_si256(lanes, keys);
+            __m256i product = _mm256_mul_epu32(keyed,
+                _mm256_srli_epi64(keyed, 32));
+            __m256i rotated = _mm256_or_si256(
+                _mm256_slli_epi64(acc, Rotation),
+                _mm256_srli_epi64(acc, 64 - Rotation));
+
+            acc = _mm256_add_epi64(_mm256_add_epi64(rotated, product), lanes);
+
+            if(offset + StripeSize >= size)
+            {
+                break;
+            }
+        }
+
+        uint64_t result[4];
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(result), acc);
+        return Finalize(result, size);
+    }
+
+    /**
+     * AVX2 byte mismatch
+     */
+    __attribute__((target("avx2")))
+    size_t MismatchBytesAVX2(const void *a, const void *b, size_t size)
+    {
+        const unsigned char *x = static_cast<const unsigned char *>(a);
+        const unsigned char *y = static_cast<const unsigned char *>(b);
+        size_t i = 0;
+
+        for(; i + 32 <= size; i += 32)
+        {
+            unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(
+                _mm256_loadu_si256(reinterpret_cast<const __m256i *>(x + i)),
+                _mm256_loadu_si256(reinterpret_cast<const __m256i *>(y + i)))));
+
+            if(mask != 0xffffffffu)
+            {
+                return i + __builtin_ctz(~mask);
+            }
+        }
+
+        return i + MismatchBytesSSE2(x + i, y + i, size - i);
+    }
+
+    /**
+     * AVX2 float mismatch
+     */
+    __attribute__((target("avx2")))
+    size_t MismatchFloatsAVX2(const float *a, const float *b, size_t size)
+    {
+        size_t i = 0;
+
+        for(; i + 8 <= size; i += 8)
+        {
+            int mask = _mm256_movemask_ps(_mm256_cmp_ps(
+                _mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), _CMP_EQ_OQ));
+            if(mask != 0xff)
+            {
+                return i + __builtin_ctz(~mask);
+            }
+        }
+
+        return i + MismatchFloatsSSE2(a + i, b + i, size - i);
+    }
+
+    /**
+     * AVX2 double mismatch
+     */
+    __attribute__((target("avx2")))
+    size_t MismatchDoublesAVX2(const double *a, const double *b, size_t size)
+    {
+        size_t i = 0;
+
+        for(; i + 4 <= size; i += 4)
+        {
+            int mask = _mm256_movemask_pd(_mm256_cmp_pd(
+                _mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i), _CMP_EQ_OQ));
+            if(mask != 0xf)
+            {
+                return i + __builtin_ctz(~mask);
+            }
+        }
+
+        return i + MismatchDoublesSSE2(a + i, b + i, size - i);
+    }
+#endif
+
+    /**
+     * Kernel implementations of one level
+     */
+    struct KernelTable
+    {
+        Level Kind;
+        size_t (*HashBytes)(const void *, size_t);
+        size_t (*HashFloats)(const void *, size_t);
+        size_t (*HashDoubles)(const void *, size_t);
+        size_t (*MismatchBytes)(const void *, const void *, size_t);
+        size_t (*MismatchFloats)(const float *, const float *, size_t);
+        size_t (*MismatchDoubles)(const double *, const double *, size_t);
+    };
+
+    const KernelTable ScalarKernels =
+    {
+        Level::Scalar,
+        HashBlocksScalar<Bytes>, HashBlocksScalar<Floats>,
+        HashBlocksScalar<Doubles>, MismatchBytesScalar,
+        MismatchScalar<float>, MismatchScalar<double>
+    };
+
+#ifdef DYNOBJECTS_X86_KERNELS
+    const KernelTable SSE2Kernels =
+    {
+        Level::SSE2,
+        HashBlocksSSE2<Bytes>, HashBlocksSSE2<Floats>,
+        HashBlocksSSE2<Doubles>, MismatchBytesSSE2,
+        MismatchFloatsSSE2, MismatchDoublesSSE2
+    };
+
+    const KernelTable AVX2Kernels =
+    {
+        Level::AVX2,
+        HashBlocksAVX2<Bytes>, HashBlocksAVX2<Floats>,
+        HashBlocksAVX2<Doubles>, MismatchBytesAVX2,
+        MismatchFloatsAVX2, MismatchDoublesAVX2
+    };
+#endif
+
+    /**
+     * Returns the best kernels the CPU supports up to a level
+     * @param level Maximum level
+     * @return Kernel implementations
+     */
+    const KernelTable *SelectKernels(Level level)
+    {
+#ifdef DYNOBJECTS_X86_KERNELS
+        __builtin_cpu_init();
+
+        if(level >= Level::AVX2 && __builtin_cpu_supports("avx2"))
+        {
+            return &AVX2Kernels;
+        }
+
+        if(level >= Level::SSE2 && __builtin_cpu_supports("sse2"))
+        {
+            return &SSE2Kernels;
+        }
+#endif
+        return &ScalarKernels;
+    }
+
+    /**
+     * Returns the kernels selection
+     * @return Kernel implementations in use, selected on first use
+     */
+    std::atomic<const KernelTable *> &GetKernels()
+    {
+        static std::atomic<const KernelTable *> kernels(
+            SelectKernels(Level::AVX2));
+        return kernels;
+    }
+
+    /**
+     * Returns the kernels in use
+     * @return Kernel implementations
+     */
+    inline const KernelTable &CurrentKernels()
+    {
+        return *GetKernels().load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Hashes an array of floating point items
+     * @param data Pointer to the first item
+     * @param size Number of items
+     * @param hash Block hash of the normalized items
+     * @return Hash of the items
+     */
+    template<typename _Tp>
+    size_t HashItems(const _Tp *data, size_t size,
+                     size_t (*hash)(const void *, size_t))
+    {
+        if(size * sizeof(_Tp) >= DynObjects::Kernels::LongHashSize)
+        {
+            return hash(data, size * sizeof(_Tp));
+        }
+
+        _Tp items[DynObjects::Kernels::LongHashSize / sizeof(_Tp)];
+        for(size_t i = 0; i < size; ++i)
+        {
+            items[i] = data[i] == _Tp(0) ? _Tp(0) : data[i];
+        }
+
+        return DynObjects::Kernels::HashShort(items, size * sizeof(_Tp));
+    }
+}
+
+DynObjects::Kernels::Level DynObjects::Kernels::GetLevel()
+{
+    return CurrentKernels().Kind;
+}
+
+DynObjects::Kernels::Level DynObjects::Kernels::SetLevel(Level level)
+{
+    const KernelTable *kernels = SelectKernels(level);
+    GetKernels().store(kernels, std::memory_order_relaxed);
+    return kernels->Kind;
+}
+
+size_t DynObjects::Kernels::HashBlocks(const void *data, size_t size)
+{
+    return CurrentKernels().HashBytes(data, size);
+}
+
+size_t DynObjects::Kernels::HashFloats(const float *data, size_t size)
+{
+    return HashItems(data, size, CurrentKernels().HashFloats);
+}
+
+size_t DynObjects::Kernels::HashDoubles(const double *data, size_t size)
+{
+    return HashItems(data, size, CurrentKernels().HashDoubles);
+}
+
+size_t DynObjects::Kernels::MismatchBytes(const void *a, const void *b,
+                                          size_t size)
+{
+    return CurrentKernels().MismatchBytes(a, b, size);
+}
+
+size_t DynObjects::Kernels::Mismatch(const float *a, const float *b,
+                                     size_t size)
+{
+    return CurrentKernels().MismatchFloats(a, b, size);
+}
+
+size_t DynObjects::Kernels::Mismatch(const double *a, const double *b,
+                                     size_t size)
+{
+    return CurrentKernels().MismatchDoubles(a, b, size);
+}
@@ -18,9 +18,78 @@
 /// Internal libs includes
 #include "dynobjects/Object.h"
 
+/// External libs includes
+
+// C++11 standard
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+    /**
+     * Graph publication state
+     */
+    struct PublishContext
+    {
+        /**
+         * Objects pending to be visited
+         */
+        std::vector<const DynObjects::Object *> Pending;
+
+        /**
+         * Objects already visited
+         */
+        std::unordered_set<const DynObjects::Object *> Visited;
+    };
+
+    /**
+     * Queues a child object for publication
+     * @param ptr Child object pointer
+     * @param context Publication state
+     */
+    void PublishVisitor(const DynObjects::ObjectPtr &ptr, void *context)
+    {
+        PublishContext &state = *static_cast<PublishContext *>(context);
+
+        if(ptr && state.Visited.insert(&*ptr).second)
+        {
+            state.Pending.push_back(&*ptr);
+        }
+    }
+}
+
+void DynObjects::Publish(const ObjectPtr &root)
+{
+    PublishContext state;
+    PublishVisitor(root, &state);
+
+    while(!state.Pending.empty())
+    {
+        const Object *object = state.Pending.back();
+        state.Pending.pop_back();
+
+        object->PublishRefCount();
+        object->ForEachChild(&PublishVisitor, &state);
+    }
+}
+
+const std::string &DynObjects::Object::GetObjectTypeName() const
+{
+    static const std::string unknown;
+    const TypeInfo *info = TypeRegistry::Find(this->m_TypeId);
+
+    return info ? info->GetName() : unknown;
+}
+
 std::ostream & operator <<( std::ostream &os,
         const DynObjects::ObjectPtr &item)
 {
     
+    return os << (item ? (*item).str() : "<NULL>");
+}
+
+std::ostream & operator <<( std::ostream &os,
+        const DynObjects::ObjectRef &item)
+{
     return os << (item ? (*item).str() : "<NULL>");
 }
\ No newline at end of file
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/// Internal libs includes
+#include "dynobjects/Record.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <functional>
+
+DynObjects::Ordering DynObjects::Record::compare(const Object &o) const
+{
+    return this->Compare(o, false);
+}
+
+DynObjects::Ordering DynObjects::Record::TotalCompare(const Object &o) const
+{
+    return this->Compare(o, true);
+}
+
+DynObjects::Ordering DynObjects::Record::Compare(const Object &o,
+                                                 bool total) const
+{
+    if(this->m_TypeId != o.GetObjectTypeId())
+    {
+        return this->CompareTypeId(o);
+    }
+
+    const Record &other = static_cast<const Record &>(o);
+    const std::vector<uint32_t> &fields = this->m_Shape->GetSortedFields();
+    const std::vector<uint32_t> &others = other.m_Shape->GetSortedFields();
+    bool sameShape = this->m_Shape == other.m_Shape;
+
+    size_t size = fields.size() < others.size() ?
+        fields.size() : others.size();
+
+    for(size_t i = 0; i < size; ++i)
+    {
+        // Records of the same shape have the same names
+        if(!sameShape)
+        {
+            int result = this->m_Shape->GetFieldName(fields[i]).compare(
+                other.m_Shape->GetFieldName(others[i]));
+
+            if(result != 0)
+            {
+                return Operators::Impl::ToOrdering(result);
+            }
+        }
+
+        const ObjectPtr &field = this->m_Fields[fields[i]];
+        const ObjectPtr &otherField = other.m_Fields[others[i]];
+        Ordering result = total ? field.TotalCompare(otherField) :
+            field.compare(otherField);
+
+        if(result != Ordering::Equal)
+        {
+            return result;
+        }
+    }
+
+    return fields.size() < others.size() ? Ordering::Less :
+        (others.size() < fields.size() ? Ordering::Greater : Ordering::Equal);
+}
+
+size_t DynObjects::Record::hash() const
+{
+    Operators::Hash<std::string> names;
+    std::hash<ObjectPtr> values;
+    size_t hash = 0;
+
+    for(uint32_t index : this->m_Shape->GetSortedFields())
+    {
+        hash = Operators::Impl::HashCombine(hash,
+            names(this->m_Shape->GetFieldName(index)));
+        hash = Operators::Impl::HashCombine(hash,
+            values(this->m_Fields[index]));
+    }
+
+    return Operators::Impl::HashCombine(hash, this->m_Fields.size());
+}
+
+void DynObjects::Record::ForEachChild(Operators::ObjectVisitor visitor,
+                                      void *context) const
+{
+    for(const ObjectPtr &value : this->m_Fields)
+    {
+        visitor(value, context);
+    }
+}
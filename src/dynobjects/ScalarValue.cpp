@@ -0,0 +1,231 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/// Internal libs includes
+#include "dynobjects/ScalarValue.h"
+#include "dynobjects/Visitor.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <string>
+
+namespace
+{
+    using namespace DynObjects;
+
+    /**
+     * Dynamic types of the items of scalar values
+     */
+    typedef TypeList<
+        Basic<bool>, Basic<char>, Basic<signed char>, Basic<unsigned char>,
+        Basic<short>, Basic<unsigned short>, Basic<int>, Basic<unsigned int>,
+        Basic<long>, Basic<unsigned long>, Basic<long long>,
+        Basic<unsigned long long>, Basic<float>, Basic<double>,
+        Generic<std::string>, Basic<Symbol>> ScalarTypes;
+
+    /**
+     * Entries of the table unboxing objects into scalar values
+     */
+    struct Unboxer
+    {
+        typedef ScalarValue (*Entry)(const Object &);
+
+        template<typename _Type>
+        static inline Entry Get()
+        {
+            return &Call<_Type>;
+        }
+
+        static ScalarValue Fallback(const Object &)
+        {
+            throw std::bad_cast();
+        }
+
+        template<typename _Type>
+        static ScalarValue Call(const Object &o)
+        {
+            return ScalarValue(*static_cast<const _Type &>(o));
+        }
+    };
+
+    /**
+     * Entries of the table unboxing objects into scalar values, without
+     * throwing
+     */
+    struct TryUnboxer
+    {
+        typedef bool (*Entry)(const Object &, ScalarValue &);
+
+        template<typename _Type>
+        static inline Entry Get()
+        {
+            return &Call<_Type>;
+        }
+
+        static bool Fallback(const Object &, ScalarValue &)
+        {
+            return false;
+        }
+
+        template<typename _Type>
+        static bool Call(const Object &o, ScalarValue &value)
+        {
+            value = ScalarValue(*static_cast<const _Type &>(o));
+            return true;
+        }
+    };
+
+    // Longer strings are not scalar values
+    template<>
+    bool TryUnboxer::Call<Generic<std::string>>(const Object &o,
+                                                ScalarValue &value)
+    {
+        const std::string &s = *static_cast<const Generic<std::string> &>(o);
+
+        if(s.size() > ScalarValue::MaxStringSize)
+        {
+            return false;
+        }
+
+        value = ScalarValue(s);
+        return true;
+    }
+
+    /**
+     * Boxes the item of a scalar value
+     */
+    struct Boxer
+    {
+        template<typename T>
+        inline ObjectPtr operator()(const T &item) const
+        {
+            return MakeObject<Basic<T>>(item);
+        }
+
+        inline ObjectPtr operator()(const ScalarValue::ShortString &item) const
+        {
+            return MakeObject<Generic<std::string>>(item.ToString());
+        }
+
+        inline ObjectPtr operator()(std::nullptr_t) const
+        {
+            return ObjectPtr();
+        }
+    };
+
+    /**
+     * Returns the type identifier of the object boxing an item
+     */
+    struct TypeIdOf
+    {
+        template<typename T>
+        inline TypeId operator()(const T &) const
+        {
+            return GetTypeId<Basic<T>>();
+        }
+
+        inline TypeId operator()(const ScalarValue::ShortString &) const
+        {
+            return GetTypeId<Generic<std::string>>();
+        }
+
+        inline TypeId operator()(std::nullptr_t) const
+        {
+            return 0;
+        }
+    };
+
+    /**
+     * Writes the item of a scalar value to a stream
+     */
+    struct Writer
+    {
+        std::ostream &Stream;
+
+        template<typename T>
+        inline std::ostream &operator()(const T &item) const
+        {
+            return this->Stream << item;
+        }
+
+        inline std::ostream &operator()(bool item) const
+        {
+            return this->Stream << (item ? "true" : "false");
+        }
+
+        inline std::ostream &operator()(
+            const ScalarValue::ShortString &item) const
+        {
+            return this->Stream.write(item.Data, item.Size);
+        }
+
+        inline std::ostream &operator()(std::nullptr_t) const
+        {
+            return this->Stream << "<NULL>";
+        }
+    };
+}
+
+DynObjects::ScalarValue::ScalarValue(const ObjectPtr &ptr) :
+m_Kind(Kind::Null), m_Item()
+{
+    if(ptr)
+    {
+        const Object &o = *ptr;
+        *this = Dispatch::Table<Unboxer, ScalarTypes>::Find(
+            o.GetObjectTypeId())(o);
+    }
+}
+
+DynObjects::ObjectPtr DynObjects::ScalarValue::ToObject() const
+{
+    return this->Apply(Boxer());
+}
+
+bool DynObjects::ScalarValue::TryFromObject(const ObjectPtr &ptr,
+                                            ScalarValue &value)
+{
+    if(!ptr)
+    {
+        value = ScalarValue();
+        return true;
+    }
+
+    const Object &o = *ptr;
+    return Dispatch::Table<TryUnboxer, ScalarTypes>::Find(
+        o.GetObjectTypeId())(o, value);
+}
+
+DynObjects::Ordering DynObjects::ScalarValue::CompareKind(
+    const ScalarValue &o) const
+{
+    // Null goes before everything else
+    if(this->IsNull() || o.IsNull())
+    {
+        return this->IsNull() ? Ordering::Less : Ordering::Greater;
+    }
+
+    return this->Apply(TypeIdOf()) < o.Apply(TypeIdOf()) ? Ordering::Less :
+        Ordering::Greater;
+}
+
+std::ostream &DynObjects::operator<<(std::ostream &os,
+                                     const ScalarValue &item)
+{
+    return item.Apply(Writer{os});
+}
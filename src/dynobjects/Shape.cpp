@@ -0,0 +1,188 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/// Internal libs includes
+#include "dynobjects/Shape.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <algorithm>
+#include <stdexcept>
+
+namespace
+{
+    /**
+     * Next shape identifier
+     */
+    std::atomic<uint32_t> s_NextId(1);
+
+    /**
+     * Number of shared shapes besides the root
+     */
+    std::atomic<size_t> s_SharedCount(0);
+
+    /**
+     * Assigns a new shape identifier
+     * @return Shape identifier
+     * @throw std::length_error If every identifier was assigned
+     */
+    uint32_t NextShapeId()
+    {
+        uint32_t id = s_NextId.fetch_add(1, std::memory_order_relaxed);
+
+        if(id == 0)
+        {
+            throw std::length_error("Too many record shapes created");
+        }
+
+        return id;
+    }
+
+    /**
+     * Reserves room for a new shared shape
+     * @return Whether or not there are less than MaxShapes shared shapes
+     */
+    bool ReserveSharedShape()
+    {
+        size_t count = s_SharedCount.load(std::memory_order_relaxed);
+
+        do
+        {
+            if(count >= DynObjects::Shape::MaxShapes)
+            {
+                return false;
+            }
+        }
+        while(!s_SharedCount.compare_exchange_weak(count, count + 1,
+                                                   std::memory_order_relaxed));
+
+        return true;
+    }
+}
+
+DynObjects::Shape::Shape(const Shape *parent, const std::string &name,
+                         bool shared) :
+m_Parent(shared ? parent : nullptr), m_Id(shared ? NextShapeId() : 0),
+m_CapacityHint(0)
+{
+    if(parent == nullptr)
+    {
+        return;
+    }
+
+    this->m_Names = parent->m_Names;
+    this->m_Index = parent->m_Index;
+    this->m_Sorted = parent->m_Sorted;
+    this->Append(name);
+}
+
+const DynObjects::Shape &DynObjects::Shape::GetRoot()
+{
+    static const Shape *root = new Shape(nullptr, std::string(), true);
+    return *root;
+}
+
+const DynObjects::Shape &DynObjects::Shape::AddField(
+    const std::string &name) const
+{
+    const Shape *shape = this->TryAddField(name);
+
+    if(shape == nullptr)
+    {
+        throw std::length_error("Shape can not have more children");
+    }
+
+    return *shape;
+}
+
+const DynObjects::Shape *DynObjects::Shape::TryAddField(
+    const std::string &name) const
+{
+    if(this->FindField(name) != NoField)
+    {
+        return this;
+    }
+
+    if(!this->IsShared())
+    {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+    auto it = this->m_Transitions.find(name);
+    if(it != this->m_Transitions.end())
+    {
+        return it->second;
+    }
+
+    if(this->m_Transitions.size() >= MaxTransitions || !ReserveSharedShape())
+    {
+        return nullptr;
+    }
+
+    const Shape *child = new Shape(this, name, true);
+    this->m_Transitions.emplace(name, child);
+
+    // Records of the ancestors will likely grow as big
+    for(const Shape *shape = this; shape != nullptr; shape = shape->m_Parent)
+    {
+        size_t hint = shape->m_CapacityHint.load(std::memory_order_relaxed);
+
+        while(hint < child->GetSize() &&
+              !shape->m_CapacityHint.compare_exchange_weak(hint,
+                  child->GetSize(), std::memory_order_relaxed))
+        {
+        }
+    }
+
+    return child;
+}
+
+size_t DynObjects::Shape::GetSharedCount()
+{
+    return s_SharedCount.load(std::memory_order_relaxed);
+}
+
+std::shared_ptr<DynObjects::Shape> DynObjects::Shape::Derive(
+    const std::string &name) const
+{
+    return std::shared_ptr<Shape>(new Shape(this, name, false));
+}
+
+void DynObjects::Shape::Append(const std::string &name)
+{
+    uint32_t index = static_cast<uint32_t>(this->m_Names.size());
+
+    this->m_Names.push_back(name);
+    this->m_CapacityHint.store(this->m_Names.size(),
+                               std::memory_order_relaxed);
+    this->m_Index.emplace(name, index);
+
+    // Insert the new field keeping the indices sorted by name
+    const std::vector<std::string> &names = this->m_Names;
+    this->m_Sorted.insert(std::upper_bound(this->m_Sorted.begin(),
+        this->m_Sorted.end(), name, [&names](const std::string &n,
+        uint32_t i) { return n < names[i]; }), index);
+}
+
+size_t DynObjects::Shape::FindField(const std::string &name) const
+{
+    auto it = this->m_Index.find(name);
+    return it != this->m_Index.end() ? it->second : NoField;
+}
@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/// Internal libs includes
+#include "dynobjects/TypeRegistry.h"
+#include "dynobjects/Utils.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    /**
+     * Number of identifiers per table chunk
+     */
+    const size_t ChunkSize = 256;
+
+    /**
+     * Maximum number of table chunks
+     */
+    const size_t MaxChunks = 256;
+
+    /**
+     * Name index, immutable once published
+     */
+    typedef std::unordered_map<std::string,
+        const DynObjects::TypeInfo *> NameIndex;
+
+    /**
+     * Registry state
+     */
+    struct Registry
+    {
+        /**
+         * Serializes registrations
+         */
+        std::mutex Mutex;
+
+        /**
+         * Registered types by dynamic type
+         */
+        std::unordered_map<std::type_index, const DynObjects::TypeInfo *> Types;
+
+        /**
+         * Registered types by identifier, split in lazily allocated chunks
+         */
+        std::atomic<std::atomic<const DynObjects::TypeInfo *> *>
+            Chunks[MaxChunks];
+
+        /**
+         * Current name index
+         */
+        std::atomic<const NameIndex *> Names;
+
+        /**
+         * Every name index ever published, readers may still hold them
+         */
+        std::vector<const NameIndex *> Retired;
+
+        /**
+         * Next type identifier, odd ones are left to ordering peers
+         */
+        DynObjects::TypeId NextId;
+
+        Registry() : Names(new NameIndex()), NextId(2)
+        {
+            for(size_t i = 0; i < MaxChunks; ++i)
+            {
+                this->Chunks[i].store(nullptr, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    /**
+     * Returns the registry, constructed on first use so types can be
+     * registered during static initialization
+     * @return Registry state
+     */
+    Registry &GetRegistry()
+    {
+        static Registry *registry = new Registry();
+        return *registry;
+    }
+}
+
+DynObjects::TypeInfo::TypeInfo(TypeId id, const std::type_info &type,
+                               const std::string &name) :
+m_Id(id), m_Type(type), m_Name(name), m_PointerName("Ptr<" + name + ">")
+{
+}
+
+const DynObjects::TypeInfo &DynObjects::TypeRegistry::Register(
+    const std::type_info &type, const std::type_info &value,
+    const TypeInfo *peer)
+{
+    Registry &registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.Mutex);
+
+    auto it = registry.Types.find(std::type_index(type));
+    if(it != registry.Types.end())
+    {
+        return *it->second;
+    }
+
+    TypeId id = peer ? peer->GetId() + 1 : registry.NextId;
+    size_t chunk = id / ChunkSize;
+
+    if(chunk >= MaxChunks)
+    {
+        throw std::length_error("Too many dynamic types registered");
+    }
+
+    if(peer)
+    {
+        // Peers of peers would take the identifier of another type
+        if(peer->GetId() % 2 || Find(id))
+        {
+            throw std::logic_error("Type can not be an ordering peer");
+        }
+    }
+    else
+    {
+        registry.NextId += 2;
+    }
+
+    const TypeInfo *info = new TypeInfo(id, type,
+        DemangleObjectName(value.name()));
+    registry.Types.emplace(std::type_index(type), info);
+
+    std::atomic<const TypeInfo *> *entries =
+        registry.Chunks[chunk].load(std::memory_order_relaxed);
+
+    if(entries == nullptr)
+    {
+        entries = new std::atomic<const TypeInfo *>[ChunkSize]();
+        registry.Chunks[chunk].store(entries, std::memory_order_release);
+    }
+
+    entries[id % ChunkSize].store(info, std::memory_order_release);
+
+    const NameIndex *names = registry.Names.load(std::memory_order_relaxed);
+    if(names->find(info->GetName()) == names->end())
+    {
+        NameIndex *next = new NameIndex(*names);
+        next->emplace(info->GetName(), info);
+
+        registry.Retired.push_back(names);
+        registry.Names.store(next, std::memory_order_release);
+    }
+
+    return *info;
+}
+
+const DynObjects::TypeInfo *DynObjects::TypeRegistry::Find(TypeId id)
+{
+    size_t chunk = id / ChunkSize;
+
+    if(chunk >= MaxChunks)
+    {
+        return nullptr;
+    }
+
+    std::atomic<const TypeInfo *> *entries =
+        GetRegistry().Chunks[chunk].load(std::memory_order_acquire);
+
+    return entries ?
+        entries[id % ChunkSize].load(std::memory_order_acquire) : nullptr;
+}
+
+const DynObjects::TypeInfo *DynObjects::TypeRegistry::Find(
+    const std::string &name)
+{
+    const NameIndex *names =
+        GetRegistry().Names.load(std::memory_order_acquire);
+
+    auto it = names->find(name);
+    return it != names->end() ? it->second : nullptr;
+}
@@ -0,0 +1,179 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/// Internal libs includes
+#include "dynobjects/Value.h"
+#include "dynobjects/Allocator.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <new>
+#include <stdexcept>
+
+namespace
+{
+    /**
+     * Returns the type identifier of the object a value boxes as
+     * @param value Value, not null
+     * @return Type identifier
+     */
+    DynObjects::TypeId GetValueTypeId(const DynObjects::Value &value)
+    {
+        using namespace DynObjects;
+
+        switch(value.GetKind())
+        {
+        case Value::Kind::Boolean:
+            return GetTypeId<Basic<bool>>();
+        case Value::Kind::Integer:
+            return GetTypeId<Basic<int32_t>>();
+        case Value::Kind::Double:
+            return GetTypeId<Basic<double>>();
+        default:
+            return value.GetObject().GetObjectTypeId();
+        }
+    }
+}
+
+DynObjects::ObjectPtr DynObjects::Value::ToObject() const
+{
+    switch(this->GetKind())
+    {
+    case Kind::Boolean:
+        return MakeObject<Basic<bool>>(this->AsBoolean());
+    case Kind::Integer:
+        return MakeObject<Basic<int32_t>>(this->AsInteger());
+    case Kind::Double:
+        return MakeObject<Basic<double>>(this->AsDouble());
+    case Kind::Object:
+#ifdef DYNOBJECTS_INTRUSIVE_REFCOUNT
+        return ObjectPtr(&this->GetObject());
+#else
+        return reinterpret_cast<Box *>(this->m_Bits & PayloadMask)->Pointer;
+#endif
+    default:
+        return ObjectPtr();
+    }
+}
+
+uint64_t DynObjects::Value::FromObject(const ObjectPtr &ptr)
+{
+    if(!ptr)
+    {
+        return NullBits;
+    }
+
+    const Object &o = *ptr;
+    TypeId id = o.GetObjectTypeId();
+
+    if(id == GetTypeId<Basic<bool>>())
+    {
+        return Value(*static_cast<const Basic<bool> &>(o)).m_Bits;
+    }
+
+    if(id == GetTypeId<Basic<int32_t>>())
+    {
+        return Value(*static_cast<const Basic<int32_t> &>(o)).m_Bits;
+    }
+
+    if(id == GetTypeId<Basic<double>>())
+    {
+        return Value(*static_cast<const Basic<double> &>(o)).m_Bits;
+    }
+
+#ifdef DYNOBJECTS_INTRUSIVE_REFCOUNT
+    Object *object = ptr.Acquire();
+    uint64_t bits = reinterpret_cast<uintptr_t>(object);
+#else
+    Box *box = new (Allocator::Allocate(sizeof(Box))) Box(ptr);
+    uint64_t bits = reinterpret_cast<uintptr_t>(box);
+#endif
+
+    // User space addresses fit in 48 bits on every supported platform
+    if(bits & TagMask)
+    {
+#ifdef DYNOBJECTS_INTRUSIVE_REFCOUNT
+        object->Release();
+#else
+        DestroyBox(box);
+#endif
+        throw std::runtime_error("Object address does not fit in a value");
+    }
+
+    return bits | ObjectTag;
+}
+
+#ifndef DYNOBJECTS_INTRUSIVE_REFCOUNT
+void DynObjects::Value::DestroyBox(Box *box)
+{
+    box->~Box();
+    Allocator::Deallocate(box, sizeof(Box));
+}
+#endif
+
+DynObjects::Ordering DynObjects::Value::CompareOther(const Value &o) const
+{
+    Kind kind = this->GetKind();
+    Kind other = o.GetKind();
+
+    // Null goes before everything else
+    if(kind == Kind::Null || other == Kind::Null)
+    {
+        return kind == other ? Ordering::Equal :
+            (kind == Kind::Null ? Ordering::Less : Ordering::Greater);
+    }
+
+    if(kind == other)
+    {
+        return kind == Kind::Object ?
+            this->GetObject().compare(o.GetObject()) :
+            Operators::ThreeWay<bool>::Compare(this->AsBoolean(),
+                                               o.AsBoolean());
+    }
+
+    if(kind == Kind::Object)
+    {
+        // Objects order among scalars as they do among boxed scalars
+        return this->GetObject().compare(*o.ToObject());
+    }
+
+    if(other == Kind::Object)
+    {
+        return (*this->ToObject()).compare(o.GetObject());
+    }
+
+    return GetValueTypeId(*this) < GetValueTypeId(o) ? Ordering::Less :
+        Ordering::Greater;
+}
+
+std::ostream &DynObjects::operator<<(std::ostream &os, const Value &item)
+{
+    switch(item.GetKind())
+    {
+    case Value::Kind::Boolean:
+        return os << (item.AsBoolean() ? "true" : "false");
+    case Value::Kind::Integer:
+        return os << item.AsInteger();
+    case Value::Kind::Double:
+        return os << item.AsDouble();
+    case Value::Kind::Object:
+        return os << item.GetObject().str();
+    default:
+        return os << "<NULL>";
+    }
+}
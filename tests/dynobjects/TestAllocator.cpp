@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   TestAllocator.cpp
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 13:40
+ */
+
+/// Internal libs includes
+
+#include "TestAllocator.h"
+#include "dynobjects/BasicTypes.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <cstdint>
+#include <thread>
+
+using namespace DynObjects;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestAllocator);
+
+TestAllocator::TestAllocator()
+{
+}
+
+TestAllocator::~TestAllocator()
+{
+}
+
+void TestAllocator::setUp()
+{
+}
+
+void TestAllocator::tearDown()
+{
+}
+
+void TestAllocator::testPoolMethod()
+{
+    void *pBlock = Allocator::Allocate(24);
+    Allocator::Deallocate(pBlock, 24);
+
+    void *pReused = Allocator::Allocate(20);
+    void *pLarge = Allocator::Allocate(Allocator::MaxBlockSize + 1);
+
+#ifdef DYNOBJECTS_POOL_ALLOCATOR
+    CPPUNIT_ASSERT(pReused == pBlock);
+    CPPUNIT_ASSERT(reinterpret_cast<uintptr_t>(pReused) % 16 == 0);
+#endif
+
+    Allocator::Deallocate(pReused, 20);
+    Allocator::Deallocate(pLarge, Allocator::MaxBlockSize + 1);
+
+    ObjectPtr pString = String("POOLED");
+    CPPUNIT_ASSERT(*String(pString) == "POOLED");
+}
+
+void TestAllocator::testArenaMethod()
+{
+    CPPUNIT_ASSERT(ArenaScope::GetCurrent() == nullptr);
+
+    {
+        ArenaScope arena;
+        CPPUNIT_ASSERT(ArenaScope::GetCurrent() == &arena);
+
+        {
+            Dictionary pContext;
+
+            (*pContext)[Integer(0)] = String("VALUE_INTEGER");
+            (*pContext)[String("4")] = String("VALUE_STRING");
+
+            CPPUNIT_ASSERT((*pContext)[String("4")] == String("VALUE_STRING"));
+        }
+
+        {
+            ArenaScope nested;
+            CPPUNIT_ASSERT(ArenaScope::GetCurrent() == &nested);
+        }
+
+        CPPUNIT_ASSERT(ArenaScope::GetCurrent() == &arena);
+#ifdef DYNOBJECTS_POOL_ALLOCATOR
+        CPPUNIT_ASSERT(arena.GetSize() > 0);
+#endif
+    }
+
+    CPPUNIT_ASSERT(ArenaScope::GetCurrent() == nullptr);
+}
+
+void TestAllocator::testThreadMethod()
+{
+    Vector<ObjectPtr> pValues;
+
+    std::thread producer([&pValues]()
+    {
+        for(int i = 0; i < 1000; ++i)
+        {
+            (*pValues).push_back(String(std::to_string(i)));
+        }
+    });
+    producer.join();
+
+    CPPUNIT_ASSERT(*String((*pValues)[999]) == "999");
+
+    (*pValues).clear();
+
+    std::thread consumer([]()
+    {
+        String pValue("CONSUMER");
+        CPPUNIT_ASSERT(*pValue == "CONSUMER");
+    });
+    consumer.join();
+}
\ No newline at end of file
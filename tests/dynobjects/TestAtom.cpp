@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   TestAtom.cpp
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 21:30
+ */
+
+/// Internal libs includes
+
+#include "TestAtom.h"
+#include "dynobjects/BasicTypes.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace DynObjects;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestAtom);
+
+TestAtom::TestAtom()
+{
+}
+
+TestAtom::~TestAtom()
+{
+}
+
+void TestAtom::setUp()
+{
+}
+
+void TestAtom::tearDown()
+{
+}
+
+void TestAtom::testInternMethod()
+{
+    std::string name("KEY_STORE");
+    Symbol key(name);
+    Symbol same("KEY_STORE");
+
+    CPPUNIT_ASSERT(key == same);
+    CPPUNIT_ASSERT(&key.GetName() == &same.GetName());
+    CPPUNIT_ASSERT(key.GetHash() == std::hash<ObjectPtr>()(String(name)));
+    CPPUNIT_ASSERT(Symbol("PRIVATE") != key);
+    CPPUNIT_ASSERT(Symbol("PRIVATE") < Symbol("PUBLIC"));
+    CPPUNIT_ASSERT(!(key < same) && !(same < key));
+    CPPUNIT_ASSERT(Symbol() == Symbol(""));
+
+    // Finding does not intern
+    Symbol found;
+    size_t count = Symbol::GetCount();
+    CPPUNIT_ASSERT(!Symbol::Find("TestAtom::testInternMethod", found));
+    CPPUNIT_ASSERT(Symbol::GetCount() == count);
+    CPPUNIT_ASSERT(Symbol::Find("KEY_STORE", found) && found == key);
+
+    // Atoms are objects holding symbols
+    Atom pKey("KEY_STORE");
+    CPPUNIT_ASSERT(*pKey == key);
+    CPPUNIT_ASSERT(ObjectPtr(pKey) == ObjectPtr(Atom(name)));
+    CPPUNIT_ASSERT(ObjectPtr(pKey) != ObjectPtr(String(name)));
+    CPPUNIT_ASSERT(ObjectPtr(pKey).compare(Atom("PUBLIC")) == Ordering::Less);
+}
+
+void TestAtom::testDictionaryMethod()
+{
+    Map<Symbol, ObjectPtr> pKeyStore;
+    (*pKeyStore)["PRIVATE"] = String("PRIVATE");
+    (*pKeyStore)["PUBLIC"] = String("PUBLIC");
+
+    Map<Symbol, ObjectPtr> pOther;
+    (*pOther)["PUBLIC"] = String("PUBLIC");
+    (*pOther)["PRIVATE"] = String("PRIVATE");
+
+    CPPUNIT_ASSERT(ObjectPtr(pKeyStore) == ObjectPtr(pOther));
+    CPPUNIT_ASSERT(std::hash<ObjectPtr>()(pKeyStore) ==
+        std::hash<ObjectPtr>()(pOther));
+
+    FlatMap<Symbol, ObjectPtr> pFlat;
+    (*pFlat)["PRIVATE"] = Integer(1);
+    CPPUNIT_ASSERT((*pFlat).at(Symbol("PRIVATE")) == Integer(1));
+
+    Dictionary pContext;
+    (*pContext)[Atom("KEY_STORE")] = pKeyStore;
+    (*pContext)[String("KEY_STORE")] = Integer(2);
+
+    CPPUNIT_ASSERT((*pContext).size() == 2);
+    CPPUNIT_ASSERT((*pContext).at(Atom("KEY_STORE")) == pOther);
+    CPPUNIT_ASSERT((*pContext).find(Symbol("KEY_STORE")) !=
+        (*pContext).end());
+    CPPUNIT_ASSERT((*pContext).at(std::string("KEY_STORE")) == Integer(2));
+    CPPUNIT_ASSERT((*pContext).find(Symbol("PUBLIC")) == (*pContext).end());
+}
+
+void TestAtom::testConcurrencyMethod()
+{
+    const size_t Threads = 4;
+    const size_t Names = 2000;
+
+    std::vector<std::vector<Symbol>> symbols(Threads);
+    std::vector<std::thread> threads;
+
+    for(size_t t = 0; t < Threads; ++t)
+    {
+        threads.emplace_back([t, &symbols]()
+        {
+            for(size_t i = 0; i < Names; ++i)
+            {
+                size_t index = (i * 7 + t * 13) % Names;
+                symbols[t].push_back(
+                    Symbol("TestAtom::" + std::to_string(index)));
+            }
+        });
+    }
+
+    for(std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    // Every thread got the same entry for the same name
+    for(size_t t = 0; t < Threads; ++t)
+    {
+        for(size_t i = 0; i < Names; ++i)
+        {
+            size_t index = (i * 7 + t * 13) % Names;
+            Symbol expected("TestAtom::" + std::to_string(index));
+
+            CPPUNIT_ASSERT(symbols[t][i] == expected);
+            CPPUNIT_ASSERT(&symbols[t][i].GetName() == &expected.GetName());
+        }
+    }
+}
\ No newline at end of file
@@ -26,8 +26,33 @@
 
 #include "TestBasic.h"
 
+/// External libs includes
+
+// C++11 standard
+#include <algorithm>
+#include <limits>
+#include <unordered_set>
+#include <vector>
+
 using namespace DynObjects;
 
+namespace
+{
+    /**
+     * Returns whether or not the objects of a basic instance type take no
+     * more than the per-object overhead budget on top of their item
+     */
+    template<typename _Instance>
+    bool IsWithinBudget()
+    {
+        typedef typename _Instance::object_type _Type;
+
+        size_t align = alignof(_Type);
+        size_t budget = ObjectOverhead + sizeof(typename _Instance::value_type);
+        return sizeof(_Type) <= (budget + align - 1) / align * align;
+    }
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION(TestBasic);
 
 TestBasic::TestBasic()
@@ -64,4 +89,144 @@ void TestBasic::testComparatorMethod()
 {
     Integer integer = -6;
     CPPUNIT_ASSERT(integer == -6);
+
+    ObjectPtr pLow = Integer(-6);
+    ObjectPtr pHigh = Integer(4);
+    ObjectPtr pNaN = Double(std::numeric_limits<double>::quiet_NaN());
+
+    CPPUNIT_ASSERT(pLow.compare(pHigh) == Ordering::Less);
+    CPPUNIT_ASSERT(pHigh.compare(pLow) == Ordering::Greater);
+    CPPUNIT_ASSERT(pLow.compare(integer) == Ordering::Equal);
+    CPPUNIT_ASSERT(pLow <= integer && pLow >= integer);
+    CPPUNIT_ASSERT(pNaN.compare(pNaN) == Ordering::Unordered);
+    CPPUNIT_ASSERT(pNaN != pNaN && !(pNaN <= pNaN));
+}
+
+void TestBasic::testInlineStorageMethod()
+{
+    Double number = 2.5;
+    ObjectPtr copy = number;
+    StringMap pContext = StringMap();
+
+    (*pContext)["BOOLEAN"] = Boolean(true);
+
+#if DYNOBJECTS_INLINE_STORAGE_SIZE
+    CPPUNIT_ASSERT(number.IsInlined() && copy.IsInlined());
+#endif
+    CPPUNIT_ASSERT(!pContext.IsInlined());
+    CPPUNIT_ASSERT(copy == Double(2.5) && *Double(copy) == 2.5);
+    CPPUNIT_ASSERT((*pContext)["BOOLEAN"] == Boolean(true));
+}
+
+void TestBasic::testSharedHandleMethod()
+{
+    Integer number = 5;
+    Integer copy = number;
+    StringMap pContext = StringMap();
+
+    (*pContext)["COUNT"] = Integer(1);
+    Integer count = (*pContext)["COUNT"];
+
+    *copy = 6;
+    *count = 2;
+
+#if DYNOBJECTS_INLINE_STORAGE_SIZE
+    // Inline values are copied along with the pointer
+    CPPUNIT_ASSERT(*number == 5 && *copy == 6);
+    CPPUNIT_ASSERT(*Integer((*pContext)["COUNT"]) == 1);
+#else
+    CPPUNIT_ASSERT(*number == 6 && *copy == 6);
+    CPPUNIT_ASSERT(*Integer((*pContext)["COUNT"]) == 2);
+#endif
+}
+
+void TestBasic::testTypeIdMethod()
+{
+    Integer integer = 1;
+    Long number = 1;
+    ObjectPtr pInteger = integer;
+    ObjectPtr pNumber = number;
+
+    CPPUNIT_ASSERT((*pInteger).GetObjectTypeId() == GetTypeId<Basic<int>>());
+    CPPUNIT_ASSERT((*pInteger).GetObjectTypeId() != (*pNumber).GetObjectTypeId());
+    CPPUNIT_ASSERT(pInteger != pNumber && !(pInteger == pNumber));
+    CPPUNIT_ASSERT(pInteger.compare(pNumber) != Ordering::Equal);
+    CPPUNIT_ASSERT((pInteger < pNumber) != (pNumber < pInteger));
+    CPPUNIT_ASSERT((pInteger < pNumber) == ((*pInteger).GetObjectTypeId() <
+                                            (*pNumber).GetObjectTypeId()));
+}
+
+void TestBasic::testTypeRegistryMethod()
+{
+    ObjectPtr integer = Integer(1);
+    const TypeInfo *info = TypeRegistry::Find((*integer).GetObjectTypeId());
+
+    CPPUNIT_ASSERT(info && info->GetName() == "int");
+    CPPUNIT_ASSERT(&(*integer).GetObjectTypeName() == &info->GetName());
+    CPPUNIT_ASSERT(integer.GetObjectType() == "Ptr<int>");
+    CPPUNIT_ASSERT(TypeRegistry::Find("int") == info);
+    CPPUNIT_ASSERT(TypeRegistry::Find("<unknown>") == nullptr);
+}
+
+void TestBasic::testLayoutMethod()
+{
+    CPPUNIT_ASSERT(sizeof(Object) <= ObjectOverhead);
+
+    CPPUNIT_ASSERT(IsWithinBudget<Char>());
+    CPPUNIT_ASSERT(IsWithinBudget<Short>());
+    CPPUNIT_ASSERT(IsWithinBudget<Integer>());
+    CPPUNIT_ASSERT(IsWithinBudget<Long>());
+    CPPUNIT_ASSERT(IsWithinBudget<Int8>());
+    CPPUNIT_ASSERT(IsWithinBudget<Int16>());
+    CPPUNIT_ASSERT(IsWithinBudget<Int32>());
+    CPPUNIT_ASSERT(IsWithinBudget<Int64>());
+    CPPUNIT_ASSERT(IsWithinBudget<UChar>());
+    CPPUNIT_ASSERT(IsWithinBudget<UShort>());
+    CPPUNIT_ASSERT(IsWithinBudget<UInteger>());
+    CPPUNIT_ASSERT(IsWithinBudget<ULong>());
+    CPPUNIT_ASSERT(IsWithinBudget<UInt8>());
+    CPPUNIT_ASSERT(IsWithinBudget<UInt16>());
+    CPPUNIT_ASSERT(IsWithinBudget<UInt32>());
+    CPPUNIT_ASSERT(IsWithinBudget<UInt64>());
+    CPPUNIT_ASSERT(IsWithinBudget<Boolean>());
+    CPPUNIT_ASSERT(IsWithinBudget<Float>());
+    CPPUNIT_ASSERT(IsWithinBudget<Double>());
+
+    // Small items fit in the padding of the shared object interface
+#ifndef DYNOBJECTS_INTRUSIVE_REFCOUNT
+    CPPUNIT_ASSERT(sizeof(Basic<bool>) == ObjectOverhead);
+    CPPUNIT_ASSERT(sizeof(Basic<int>) == ObjectOverhead);
+#endif
+}
+
+void TestBasic::testStaticDispatchMethod()
+{
+    Integer pOne(1);
+    Integer pTwo(2);
+
+    CPPUNIT_ASSERT(pOne.compare(pTwo) == Ordering::Less);
+    CPPUNIT_ASSERT(pOne < pTwo && pTwo > pOne && pOne != pTwo);
+    CPPUNIT_ASSERT(pOne <= Integer(1) && pOne >= Integer(1));
+    CPPUNIT_ASSERT(pOne.hash() == std::hash<ObjectPtr>()(pOne));
+    CPPUNIT_ASSERT(std::hash<Integer>()(pOne) == pOne.hash());
+
+    // Pointers of other types go through the object interface
+    ObjectPtr pText = String("1");
+    CPPUNIT_ASSERT(pOne != pText);
+    CPPUNIT_ASSERT((pOne < pText) == (ObjectPtr(pOne) < pText));
+    CPPUNIT_ASSERT(pOne.compare(pText) == ObjectPtr(pOne).compare(pText));
+    CPPUNIT_ASSERT(String("A").compare(Text("A")) == Ordering::Equal);
+
+    // Frozen objects keep caching their hash
+    String pFrozen("VALUE");
+    pFrozen.GetObject().Freeze();
+    CPPUNIT_ASSERT(pFrozen.hash() == std::hash<ObjectPtr>()(String("VALUE")));
+    CPPUNIT_ASSERT(pFrozen.hash() == std::hash<String>()(pFrozen));
+
+    std::vector<Integer> items = {Integer(3), Integer(-1), Integer(2)};
+    std::sort(items.begin(), items.end());
+    CPPUNIT_ASSERT(*items[0] == -1 && *items[1] == 2 && *items[2] == 3);
+
+    std::unordered_set<Integer> set(items.begin(), items.end());
+    CPPUNIT_ASSERT(set.count(Integer(2)) && !set.count(Integer(4)));
 }
\ No newline at end of file
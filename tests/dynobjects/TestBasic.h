@@ -48,6 +48,12 @@ private:
     CPPUNIT_TEST(testComparatorMethod);
     CPPUNIT_TEST(testDereferenceMethod);
     CPPUNIT_TEST(testEncapsulatedComparatorMethod);
+    CPPUNIT_TEST(testInlineStorageMethod);
+    CPPUNIT_TEST(testSharedHandleMethod);
+    CPPUNIT_TEST(testTypeIdMethod);
+    CPPUNIT_TEST(testTypeRegistryMethod);
+    CPPUNIT_TEST(testLayoutMethod);
+    CPPUNIT_TEST(testStaticDispatchMethod);
 
     CPPUNIT_TEST_SUITE_END();
 
@@ -61,6 +67,12 @@ private:
     void testComparatorMethod();
     void testDereferenceMethod();
     void testEncapsulatedComparatorMethod();
+    void testInlineStorageMethod();
+    void testSharedHandleMethod();
+    void testTypeIdMethod();
+    void testTypeRegistryMethod();
+    void testLayoutMethod();
+    void testStaticDispatchMethod();
 };
 
 #endif /* TESTGENERIC_H */
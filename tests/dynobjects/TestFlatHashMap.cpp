@@ -0,0 +1,256 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   TestFlatHashMap.cpp
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 16:30
+ */
+
+/// Internal libs includes
+
+#include "TestFlatHashMap.h"
+#include "dynobjects/BasicTypes.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+using namespace DynObjects;
+
+/**
+ * Number of allocations of the test program, counted by the operator new
+ * of TestGeneric
+ */
+extern std::atomic<size_t> g_Allocations;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestFlatHashMap);
+
+TestFlatHashMap::TestFlatHashMap()
+{
+}
+
+TestFlatHashMap::~TestFlatHashMap()
+{
+}
+
+void TestFlatHashMap::setUp()
+{
+}
+
+void TestFlatHashMap::tearDown()
+{
+}
+
+void TestFlatHashMap::testInsertMethod()
+{
+    FlatHashMap<int, std::string> items;
+
+    CPPUNIT_ASSERT(items.empty() && items.begin() == items.end());
+    CPPUNIT_ASSERT(items.find(0) == items.end());
+
+    for(int i = 0; i < 1000; ++i)
+    {
+        items[i] = std::to_string(i);
+    }
+
+    CPPUNIT_ASSERT(items.size() == 1000);
+    CPPUNIT_ASSERT(items.capacity() >= 1000);
+    CPPUNIT_ASSERT(!items.try_emplace(10, "OTHER").second);
+    CPPUNIT_ASSERT(items.at(10) == "10" && items.contains(999));
+    CPPUNIT_ASSERT(!items.contains(1000));
+    CPPUNIT_ASSERT_THROW(items.at(1000), std::out_of_range);
+
+    size_t count = 0;
+    for(const auto &item : items)
+    {
+        CPPUNIT_ASSERT(item.second == std::to_string(item.first));
+        ++count;
+    }
+
+    CPPUNIT_ASSERT(count == items.size());
+
+    // Values built from items of the table survive growing it
+    FlatHashMap<int, std::string> chain;
+    chain[0] = std::string(64, 'X');
+
+    for(int i = 1; i < 1000; ++i)
+    {
+        CPPUNIT_ASSERT(chain.try_emplace(i, chain.at(i - 1)).second);
+    }
+
+    CPPUNIT_ASSERT(chain.size() == 1000);
+    CPPUNIT_ASSERT(chain.at(999) == std::string(64, 'X'));
+}
+
+void TestFlatHashMap::testEraseMethod()
+{
+    FlatHashMap<int, int> items;
+    std::unordered_map<int, int> reference;
+
+    for(int i = 0; i < 20000; ++i)
+    {
+        int key = (i * 7919) % 331;
+
+        if(i % 3 == 0)
+        {
+            CPPUNIT_ASSERT(items.erase(key) == reference.erase(key));
+        }
+        else
+        {
+            items[key] = i;
+            reference[key] = i;
+        }
+    }
+
+    CPPUNIT_ASSERT(items.size() == reference.size());
+    for(const auto &item : reference)
+    {
+        CPPUNIT_ASSERT(items.at(item.first) == item.second);
+    }
+
+    for(auto it = items.begin(); it != items.end(); )
+    {
+        it = it->first % 2 ? items.erase(it) : ++it;
+    }
+
+    for(const auto &item : items)
+    {
+        CPPUNIT_ASSERT(item.first % 2 == 0);
+    }
+
+    items.clear();
+    CPPUNIT_ASSERT(items.empty() && items.begin() == items.end());
+}
+
+void TestFlatHashMap::testCopyMethod()
+{
+    FlatHashMap<std::string, int> items = {{"A", 0}, {"B", 1}};
+
+    // Keys read from the map itself survive the growth of the table
+    for(int i = 0; i < 100; ++i)
+    {
+        items[items.begin()->first + std::to_string(i)] = i;
+    }
+
+    FlatHashMap<std::string, int> copy(items);
+    CPPUNIT_ASSERT(copy == items && copy.size() == 102);
+
+    FlatHashMap<std::string, int> moved(std::move(copy));
+    CPPUNIT_ASSERT(moved == items && copy.empty());
+
+    moved["A"] = 2;
+    CPPUNIT_ASSERT(moved != items);
+}
+
+void TestFlatHashMap::testDictionaryMethod()
+{
+    Dictionary pContext;
+
+    (*pContext)[Integer(0)] = String("VALUE_INTEGER");
+    (*pContext)[Long(0)] = String("VALUE_LONG");
+    (*pContext)[String("4")] = String("VALUE_STRING");
+
+    for(int i = 1; i < 100; ++i)
+    {
+        (*pContext)[Integer(i)] = Integer(-i);
+    }
+
+    CPPUNIT_ASSERT((*pContext).size() == 102);
+    CPPUNIT_ASSERT((*pContext)[Integer(0)] == String("VALUE_INTEGER"));
+    CPPUNIT_ASSERT((*pContext)[Long(0)] == String("VALUE_LONG"));
+    CPPUNIT_ASSERT((*pContext).at(Integer(99)) == Integer(-99));
+    CPPUNIT_ASSERT(!(*pContext).contains(String("5")));
+
+    Dictionary pCopy = Dictionary();
+    *pCopy = *pContext;
+    CPPUNIT_ASSERT(ObjectPtr(pCopy) == ObjectPtr(pContext));
+}
+
+void TestFlatHashMap::testRawKeyMethod()
+{
+    Dictionary pContext;
+    std::string key(64, 'K');
+
+    (*pContext)[String("4")] = String("VALUE_STRING");
+    (*pContext)[String(key)] = String("VALUE_LONG_STRING");
+    (*pContext)[WString(L"4")] = String("VALUE_WSTRING");
+    (*pContext)[Integer(4)] = String("VALUE_INTEGER");
+    (*pContext)[Double(2.5)] = String("VALUE_DOUBLE");
+
+    CPPUNIT_ASSERT(DictionaryHash()(String(key)) == DictionaryHash()(key));
+    CPPUNIT_ASSERT(DictionaryHash()(String(key)) ==
+        DictionaryHash()(key.c_str()));
+    CPPUNIT_ASSERT(DictionaryHash()(WString(L"4")) == DictionaryHash()(L"4"));
+    CPPUNIT_ASSERT(DictionaryHash()(Double(2.5)) == DictionaryHash()(2.5));
+
+    CPPUNIT_ASSERT((*pContext).at("4") == String("VALUE_STRING"));
+    CPPUNIT_ASSERT((*pContext).at(key) == String("VALUE_LONG_STRING"));
+    CPPUNIT_ASSERT((*pContext).at(key.c_str()) == String("VALUE_LONG_STRING"));
+    CPPUNIT_ASSERT((*pContext).at(L"4") == String("VALUE_WSTRING"));
+    CPPUNIT_ASSERT((*pContext).at(4) == String("VALUE_INTEGER"));
+    CPPUNIT_ASSERT((*pContext).find(2.5)->second == String("VALUE_DOUBLE"));
+    CPPUNIT_ASSERT((*pContext).find(String("4"))->second ==
+        String("VALUE_STRING"));
+
+    // Raw keys only match objects of the type they are boxed in
+    CPPUNIT_ASSERT(!(*pContext).contains(4L));
+    CPPUNIT_ASSERT(!(*pContext).contains(4.0));
+    CPPUNIT_ASSERT(!(*pContext).contains("5"));
+    CPPUNIT_ASSERT((*pContext).count(std::string("4")) == 1);
+    CPPUNIT_ASSERT_THROW((*pContext).at("5"), std::out_of_range);
+}
+
+void TestFlatHashMap::testRawKeyAllocationMethod()
+{
+    Dictionary pContext;
+    std::string key(64, 'K');
+    const char *raw = key.c_str();
+
+    (*pContext)[String(key)] = Integer(1);
+    (*pContext)[String("4")] = Integer(2);
+    (*pContext)[Integer(4)] = Integer(3);
+
+    // Raw keys are neither boxed nor copied, from the pools or the heap
+    ArenaScope scope;
+    size_t allocations = g_Allocations;
+    size_t found = 0;
+
+    for(int i = 0; i < 100; ++i)
+    {
+        found += (*pContext).count(key);
+        found += (*pContext).count(raw);
+        found += (*pContext).count("4");
+        found += (*pContext).count(4);
+        found += (*pContext).find(key) != (*pContext).end();
+        found += (*pContext).find(raw) != (*pContext).end();
+    }
+
+    CPPUNIT_ASSERT(found == 600);
+    CPPUNIT_ASSERT(g_Allocations == allocations);
+    CPPUNIT_ASSERT(scope.GetSize() == 0);
+
+    // Boxed keys are seen allocating
+    CPPUNIT_ASSERT((*pContext).count(String(key)) == 1);
+    CPPUNIT_ASSERT(g_Allocations != allocations || scope.GetSize() != 0);
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   TestFlatHashMap.h
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 16:30
+ */
+
+#ifndef TEST_DYNOBJECTS_FLAT_HASH_MAP_H
+#define TEST_DYNOBJECTS_FLAT_HASH_MAP_H
+
+/// Internal libs includes
+#include "dynobjects/Standard.h"
+
+/// External libs includes
+
+// CppUnit
+#include <cppunit/extensions/HelperMacros.h>
+
+class TestFlatHashMap : public CPPUNIT_NS::TestFixture
+{
+private:
+
+    /// Test registration
+
+    CPPUNIT_TEST_SUITE(TestFlatHashMap);
+
+    CPPUNIT_TEST(testInsertMethod);
+    CPPUNIT_TEST(testEraseMethod);
+    CPPUNIT_TEST(testCopyMethod);
+    CPPUNIT_TEST(testDictionaryMethod);
+    CPPUNIT_TEST(testRawKeyMethod);
+    CPPUNIT_TEST(testRawKeyAllocationMethod);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    TestFlatHashMap();
+    virtual ~TestFlatHashMap();
+    void setUp();
+    void tearDown();
+
+private:
+    void testInsertMethod();
+    void testEraseMethod();
+    void testCopyMethod();
+    void testDictionaryMethod();
+    void testRawKeyMethod();
+    void testRawKeyAllocationMethod();
+};
+
+#endif /* TEST_DYNOBJECTS_FLAT_HASH_MAP_H */
+
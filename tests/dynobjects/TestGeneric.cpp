@@ -27,8 +27,85 @@
 #include "TestGeneric.h"
 #include "dynobjects/BasicTypes.h"
 
+/// External libs includes
+
+// C++11 standard
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <limits>
+#include <new>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 using namespace DynObjects;
 
+namespace
+{
+    /**
+     * Size from which allocations are counted
+     */
+    const size_t LargeAllocation = 4096;
+
+    /**
+     * Number of large allocations
+     */
+    std::atomic<size_t> g_LargeAllocations(0);
+
+    /**
+     * Returns whether or not the objects of a generic instance type take no
+     * more than the per-object overhead budget and the hash state on top of
+     * their item
+     */
+    template<typename _Instance>
+    bool IsWithinBudget()
+    {
+        typedef typename _Instance::object_type _Type;
+
+        size_t align = alignof(_Type);
+        size_t budget = ObjectOverhead + sizeof(size_t) +
+            sizeof(typename _Instance::value_type);
+        return sizeof(_Type) <= (budget + align - 1) / align * align;
+    }
+}
+
+/**
+ * Number of allocations of the test program, see TestFlatHashMap
+ */
+std::atomic<size_t> g_Allocations(0);
+
+void *operator new(size_t size)
+{
+    ++g_Allocations;
+
+    if(size >= LargeAllocation)
+    {
+        ++g_LargeAllocations;
+    }
+
+    void *ptr = std::malloc(size ? size : 1);
+    if(ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return ptr;
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION(TestGeneric);
 
 TestGeneric::TestGeneric()
@@ -95,4 +172,395 @@ void TestGeneric::testComparatorMethod()
     (*pContext)["KEY_STORE"] = pKeyStore;
     CPPUNIT_ASSERT(String((*StringMap(
     (*pContext)["KEY_STORE"]))["PRIVATE"]) == std::string("PRIVATE"));
+}
+
+void TestGeneric::testCheckedCastMethod()
+{
+    StringMap pContext = StringMap();
+
+    (*pContext)["KEY_STORE"] = StringMap();
+    (*pContext)["PRIVATE"] = String("PRIVATE");
+
+    CPPUNIT_ASSERT((*StringMap((*pContext)["KEY_STORE"])).empty());
+#if DYNOBJECTS_CHECKED_CAST
+    CPPUNIT_ASSERT_THROW(*StringMap((*pContext)["PRIVATE"]), std::bad_cast);
+#endif
+}
+
+void TestGeneric::testReferenceCountMethod()
+{
+    StringMap pContext = StringMap();
+    ObjectPtr pCopy = pContext;
+
+    (*StringMap(pCopy))["PRIVATE"] = String("PRIVATE");
+
+    CPPUNIT_ASSERT((*pContext).size() == 1);
+#ifdef DYNOBJECTS_INTRUSIVE_REFCOUNT
+    CPPUNIT_ASSERT((*pCopy).GetRefCount() == 2);
+    pCopy = ObjectPtr();
+    CPPUNIT_ASSERT(pContext.GetObject().GetRefCount() == 1);
+#if !DYNOBJECTS_INLINE_STORAGE_SIZE
+    CPPUNIT_ASSERT(sizeof(ObjectPtr) == sizeof(void *));
+#endif
+#endif
+}
+
+void TestGeneric::testSelfOwnedAssignMethod()
+{
+    typedef Vector<ObjectPtr> List;
+    typedef List::object_type ListObject;
+
+    ObjectPtr node;
+    {
+        List pInner;
+        (*pInner).push_back(Integer(1));
+        (*pInner).push_back(String("TEXT"));
+
+        List pOuter;
+        (*pOuter).push_back(pInner);
+        node = pOuter;
+    }
+
+    // The assigned pointer lives inside the only object node owns
+    node = (*ObjectCast<ListObject>(*node))[0];
+    CPPUNIT_ASSERT((*List(node)).size() == 2);
+
+    node = std::move((*ObjectCast<ListObject>(*node))[1]);
+    CPPUNIT_ASSERT(*String(node) == "TEXT");
+
+    List pList;
+    (*pList).push_back(Integer(2));
+    node = pList;
+    pList = List();
+
+    node = std::move((*ObjectCast<ListObject>(*node))[0]);
+    CPPUNIT_ASSERT(*Integer(node) == 2);
+}
+
+void TestGeneric::testPublishMethod()
+{
+    Dictionary pShared;
+    StringMap pKeyStore;
+
+    {
+        LocalRefCountScope scope;
+
+        pKeyStore = StringMap();
+        (*pKeyStore)["PRIVATE"] = String("PRIVATE");
+        (*pShared)[String("KEY_STORE")] = pKeyStore;
+    }
+
+    ObjectPtr pPrivate = (*pKeyStore)["PRIVATE"];
+
+#if defined(DYNOBJECTS_INTRUSIVE_REFCOUNT)
+    CPPUNIT_ASSERT(pKeyStore.GetObject().IsThreadConfined());
+    CPPUNIT_ASSERT((*pPrivate).IsThreadConfined());
+    CPPUNIT_ASSERT(pKeyStore.GetObject().GetRefCount() == 2);
+#endif
+#if !defined(DYNOBJECTS_NON_ATOMIC_REFCOUNT)
+    CPPUNIT_ASSERT(!pShared.GetObject().IsThreadConfined());
+
+    Publish(pShared);
+
+    CPPUNIT_ASSERT(!pKeyStore.GetObject().IsThreadConfined());
+    CPPUNIT_ASSERT(!(*pPrivate).IsThreadConfined());
+#endif
+#if defined(DYNOBJECTS_INTRUSIVE_REFCOUNT)
+    CPPUNIT_ASSERT(pKeyStore.GetObject().GetRefCount() == 2);
+#endif
+    CPPUNIT_ASSERT(*String((*StringMap(
+    (*pShared)[String("KEY_STORE")]))["PRIVATE"]) == "PRIVATE");
+}
+
+void TestGeneric::testMoveConstructionMethod()
+{
+    std::string payload(LargeAllocation, 'X');
+    size_t allocations = g_LargeAllocations;
+
+    String pCopy(payload);
+    CPPUNIT_ASSERT(g_LargeAllocations - allocations == 1);
+
+    allocations = g_LargeAllocations;
+    String pMoved(std::move(payload));
+    CPPUNIT_ASSERT(g_LargeAllocations == allocations);
+    CPPUNIT_ASSERT(pMoved == pCopy);
+
+    std::vector<ObjectPtr> items(LargeAllocation / sizeof(ObjectPtr));
+    allocations = g_LargeAllocations;
+    Vector<ObjectPtr> pItems(std::move(items));
+    CPPUNIT_ASSERT(g_LargeAllocations == allocations);
+    CPPUNIT_ASSERT((*pItems).size() == LargeAllocation / sizeof(ObjectPtr));
+
+    allocations = g_LargeAllocations;
+    String pOther = std::move(pMoved);
+    pCopy = std::move(pOther);
+    CPPUNIT_ASSERT(g_LargeAllocations == allocations);
+    CPPUNIT_ASSERT((*pCopy).size() == LargeAllocation);
+
+    std::string &value = pOther.Emplace(LargeAllocation, 'Y');
+    CPPUNIT_ASSERT(g_LargeAllocations - allocations == 1);
+    CPPUNIT_ASSERT(value == *pOther && value[0] == 'Y');
+}
+
+void TestGeneric::testThreeWayComparatorMethod()
+{
+    Vector<ObjectPtr> pValues;
+    UnorderedMap<std::string, int> pIndex;
+
+    (*pValues).push_back(String("B"));
+    (*pValues).push_back(String("A"));
+    (*pValues).push_back(String("C"));
+    (*pIndex)["A"] = 0;
+
+    std::sort((*pValues).begin(), (*pValues).end());
+
+    CPPUNIT_ASSERT(String((*pValues)[0]) == std::string("A"));
+    CPPUNIT_ASSERT(String((*pValues)[2]) == std::string("C"));
+    CPPUNIT_ASSERT((*pValues)[0].compare((*pValues)[1]) == Ordering::Less);
+    CPPUNIT_ASSERT((*pValues)[2] >= (*pValues)[1]);
+
+    Vector<ObjectPtr> pPrefix;
+    (*pPrefix).push_back(String("A"));
+
+    CPPUNIT_ASSERT(ObjectPtr(pPrefix).compare(pValues) == Ordering::Less);
+    CPPUNIT_ASSERT(ObjectPtr(pValues) > ObjectPtr(pPrefix));
+
+    StringMap pA = StringMap();
+    StringMap pB = StringMap();
+    (*pA)["KEY"] = Integer(1);
+    (*pB)["KEY"] = Integer(2);
+
+    CPPUNIT_ASSERT(ObjectPtr(pA) < ObjectPtr(pB));
+    CPPUNIT_ASSERT(ObjectPtr(pA) != ObjectPtr(pB));
+
+    UnorderedMap<std::string, int> pCopy;
+    (*pCopy)["A"] = 0;
+
+    CPPUNIT_ASSERT(ObjectPtr(pIndex) == ObjectPtr(pCopy));
+    (*pCopy)["B"] = 1;
+    CPPUNIT_ASSERT(ObjectPtr(pIndex).compare(pCopy) == Ordering::Unordered);
+    CPPUNIT_ASSERT(!(ObjectPtr(pIndex) < ObjectPtr(pCopy)));
+}
+
+void TestGeneric::testOrderedDictionaryMethod()
+{
+    Map<ObjectPtr, ObjectPtr, DictionaryComparator> pContext;
+
+    (*pContext)[Integer(0)] = String("VALUE_INTEGER");
+    (*pContext)[Long(0)] = String("VALUE_LONG");
+    (*pContext)[String("4")] = String("VALUE_STRING");
+    (*pContext)[Integer(-1)] = String("VALUE_NEGATIVE");
+
+    CPPUNIT_ASSERT((*pContext).size() == 4);
+    CPPUNIT_ASSERT((*pContext)[Integer(0)] == String("VALUE_INTEGER"));
+    CPPUNIT_ASSERT((*pContext)[Long(0)] == String("VALUE_LONG"));
+    CPPUNIT_ASSERT((*pContext).find(String("5")) == (*pContext).end());
+
+    ObjectPtr pPrevious;
+    for(const auto &item : *pContext)
+    {
+        if(pPrevious && (*pPrevious).GetObjectTypeId() ==
+           (*item.first).GetObjectTypeId())
+        {
+            CPPUNIT_ASSERT(pPrevious < item.first);
+        }
+
+        pPrevious = item.first;
+    }
+}
+
+void TestGeneric::testTotalOrderMethod()
+{
+    double nan = std::numeric_limits<double>::quiet_NaN();
+    Map<ObjectPtr, int, DictionaryComparator> pKeys;
+    Dictionary pOne;
+    Dictionary pTwo;
+    (*pOne)[Integer(1)] = Integer(1);
+    (*pTwo)[Integer(2)] = Integer(2);
+
+    std::vector<ObjectPtr> keys = {Double(nan), Double(1.0), Double(2.0),
+        pOne, pTwo};
+
+    for(size_t i = 0; i < keys.size(); ++i)
+    {
+        (*pKeys)[keys[i]] = static_cast<int>(i);
+    }
+
+    CPPUNIT_ASSERT((*pKeys).size() == 5);
+    CPPUNIT_ASSERT((*pKeys)[Double(nan)] == 0);
+    CPPUNIT_ASSERT((*pKeys)[pTwo] == 4);
+
+    DictionaryComparator less;
+    for(const ObjectPtr &a : keys)
+    {
+        for(const ObjectPtr &b : keys)
+        {
+            CPPUNIT_ASSERT(!(less(a, b) && less(b, a)));
+
+            for(const ObjectPtr &c : keys)
+            {
+                CPPUNIT_ASSERT(!(less(a, b) && less(b, c)) || less(a, c));
+            }
+        }
+    }
+
+    // NaN is greater than any number, equal payloads are equivalent
+    CPPUNIT_ASSERT(less(Double(2.0), Double(nan)));
+    CPPUNIT_ASSERT(Double(nan).TotalCompare(Double(nan)) == Ordering::Equal);
+
+    Dictionary pCopy;
+    (*pCopy)[Integer(1)] = Integer(1);
+    CPPUNIT_ASSERT(ObjectPtr(pOne).TotalCompare(pCopy) == Ordering::Equal);
+
+    Vector<double> pNaNs;
+    Vector<double> pLess;
+    (*pNaNs).assign(40, nan);
+    (*pLess).assign(40, nan);
+    (*pLess)[30] = 1.0;
+
+    CPPUNIT_ASSERT(ObjectPtr(pLess).TotalCompare(pNaNs) == Ordering::Less);
+    CPPUNIT_ASSERT(ObjectPtr(pNaNs).compare(pNaNs) == Ordering::Unordered);
+}
+
+void TestGeneric::testFrozenMethod()
+{
+    std::string key(256, 'K');
+    String pMutable(key);
+    const String pKey(Frozen, key);
+
+    CPPUNIT_ASSERT(pKey.GetObject().IsFrozen());
+    CPPUNIT_ASSERT(!pMutable.GetObject().IsFrozen());
+    CPPUNIT_ASSERT(pKey == pMutable);
+    CPPUNIT_ASSERT(pKey.GetObject().hash() == pMutable.GetObject().hash());
+    CPPUNIT_ASSERT(pKey.GetObject().hash() == pMutable.GetObject().hash());
+    CPPUNIT_ASSERT((*pKey).size() == key.size());
+
+    String pAlias = pKey;
+    CPPUNIT_ASSERT_THROW((*pAlias).append("X"), std::logic_error);
+    CPPUNIT_ASSERT(pKey == pMutable);
+
+    // Frozen objects are read without failing, the payload is not exposed
+    CPPUNIT_ASSERT(pAlias.GetValue().size() == key.size());
+    CPPUNIT_ASSERT(pAlias.GetObject().GetValue() == key);
+    CPPUNIT_ASSERT((!std::is_convertible<Generic<std::string> &,
+                    std::string &>::value));
+
+    Dictionary pContext;
+    (*pContext)[pKey] = Integer(1);
+    CPPUNIT_ASSERT((*pContext).at(key) == Integer(1));
+    CPPUNIT_ASSERT((*pContext).at(pMutable) == Integer(1));
+
+    Vector<int> pValues;
+    (*pValues).push_back(1);
+    pValues.GetObject().Freeze();
+
+    const Vector<int> &pFrozen = pValues;
+    CPPUNIT_ASSERT((*pFrozen).size() == 1 && (*pFrozen)[0] == 1);
+    CPPUNIT_ASSERT_THROW((*pValues).push_back(2), std::logic_error);
+
+    Vector<int> pCopy((*pFrozen).begin(), (*pFrozen).end());
+    (*pCopy).push_back(2);
+    CPPUNIT_ASSERT((*pCopy).size() == 2);
+
+    // Frozen objects are copied instead of moved, keys stay intact
+    Generic<std::string> source(Frozen, key);
+    CPPUNIT_ASSERT(source.hash() == pMutable.GetObject().hash());
+
+    Generic<std::string> target(std::move(source));
+    CPPUNIT_ASSERT(target.IsFrozen() && source.IsFrozen());
+    CPPUNIT_ASSERT(source.GetValue() == key && target.GetValue() == key);
+    CPPUNIT_ASSERT(target.hash() == pMutable.GetObject().hash());
+    CPPUNIT_ASSERT_THROW(*source = "VALUE", std::logic_error);
+
+    String pFrozenKey(Frozen, key);
+    Dictionary pKeys;
+    (*pKeys)[pFrozenKey] = Integer(2);
+
+    Generic<std::string> moved(std::move(pFrozenKey.GetObject()));
+    CPPUNIT_ASSERT(pFrozenKey.GetObject().IsFrozen());
+    CPPUNIT_ASSERT(pFrozenKey.GetObject().GetValue() == key);
+    CPPUNIT_ASSERT(moved.GetValue() == key);
+    CPPUNIT_ASSERT((*pKeys).at(pFrozenKey) == Integer(2));
+
+    Generic<std::string> assigned;
+    assigned = std::move(pFrozenKey.GetObject());
+    CPPUNIT_ASSERT(assigned.GetValue() == key && !assigned.IsFrozen());
+    CPPUNIT_ASSERT(pFrozenKey.GetObject().GetValue() == key);
+    CPPUNIT_ASSERT((*pKeys).at(key) == Integer(2));
+
+    Generic<std::string> mutableSource(key);
+    Generic<std::string> mutableTarget(std::move(mutableSource));
+    CPPUNIT_ASSERT(mutableTarget.GetValue() == key);
+    CPPUNIT_ASSERT(!mutableTarget.IsFrozen());
+}
+
+void TestGeneric::testStructuralHashMethod()
+{
+    std::hash<ObjectPtr> hash;
+    Vector<int> pValues(std::vector<int>{1, 2, 3});
+    Vector<int> pReversed(std::vector<int>{3, 2, 1});
+    CPPUNIT_ASSERT(hash(pValues) ==
+        hash(Vector<int>(std::vector<int>{1, 2, 3})));
+    CPPUNIT_ASSERT(hash(pValues) != hash(pReversed));
+
+    Vector<double> pZero(std::vector<double>{0.0});
+    Vector<double> pNegativeZero(std::vector<double>{-0.0});
+    CPPUNIT_ASSERT(pZero == pNegativeZero);
+    CPPUNIT_ASSERT(hash(pZero) == hash(pNegativeZero));
+
+    StringMap pRecord;
+    StringMap pOther;
+    (*pRecord)["KEY_STORE"] = String("PRIVATE");
+    (*pRecord)["ITEMS"] = pValues;
+    (*pOther)["ITEMS"] = Vector<int>(std::vector<int>{1, 2, 3});
+    (*pOther)["KEY_STORE"] = String("PRIVATE");
+    CPPUNIT_ASSERT(ObjectPtr(pRecord) == ObjectPtr(pOther));
+    CPPUNIT_ASSERT(hash(pRecord) == hash(pOther));
+
+    UnorderedMap<int, std::string> pIndex;
+    UnorderedMap<int, std::string> pRehashed;
+    (*pRehashed).rehash(1024);
+    for(int i = 0; i < 100; ++i)
+    {
+        (*pIndex)[i] = std::to_string(i);
+        (*pRehashed)[99 - i] = std::to_string(99 - i);
+    }
+    CPPUNIT_ASSERT(ObjectPtr(pIndex) == ObjectPtr(pRehashed));
+    CPPUNIT_ASSERT(hash(pIndex) == hash(pRehashed));
+
+    Dictionary pContext;
+    (*pContext)[pValues] = String("VALUE_VECTOR");
+    (*pContext)[pRecord] = String("VALUE_MAP");
+    (*pContext)[Set<int>(std::set<int>{1, 2})] = String("VALUE_SET");
+    (*pContext)[List<ObjectPtr>(1, Integer(1))] = String("VALUE_LIST");
+
+    CPPUNIT_ASSERT((*pContext).at(Vector<int>(std::vector<int>{1, 2, 3})) ==
+        String("VALUE_VECTOR"));
+    CPPUNIT_ASSERT((*pContext).at(pOther) == String("VALUE_MAP"));
+    CPPUNIT_ASSERT((*pContext).at(Set<int>(std::set<int>{2, 1})) ==
+        String("VALUE_SET"));
+    CPPUNIT_ASSERT((*pContext).at(List<ObjectPtr>(1, Integer(1))) ==
+        String("VALUE_LIST"));
+    CPPUNIT_ASSERT(!(*pContext).contains(pReversed));
+}
+
+void TestGeneric::testLayoutMethod()
+{
+    CPPUNIT_ASSERT(IsWithinBudget<Set<ObjectPtr>>());
+    CPPUNIT_ASSERT((IsWithinBudget<Map<ObjectPtr, ObjectPtr>>()));
+    CPPUNIT_ASSERT((IsWithinBudget<UnorderedMap<ObjectPtr, ObjectPtr>>()));
+    CPPUNIT_ASSERT((IsWithinBudget<FlatMap<ObjectPtr, ObjectPtr>>()));
+    CPPUNIT_ASSERT(IsWithinBudget<Dictionary>());
+    CPPUNIT_ASSERT(IsWithinBudget<NodeDictionary>());
+    CPPUNIT_ASSERT(IsWithinBudget<List<ObjectPtr>>());
+    CPPUNIT_ASSERT(IsWithinBudget<Vector<ObjectPtr>>());
+    CPPUNIT_ASSERT(IsWithinBudget<String>());
+    CPPUNIT_ASSERT(IsWithinBudget<WString>());
+
+    // The object interface and the generic object share their address
+    String pString("VALUE");
+    const Generic<std::string> &object = pString.GetObject();
+    CPPUNIT_ASSERT(static_cast<const void *>(&object) ==
+                   static_cast<const Object *>(&object));
+    CPPUNIT_ASSERT(&*pString == &*object);
 }
\ No newline at end of file
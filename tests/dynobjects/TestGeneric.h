@@ -48,6 +48,17 @@ private:
     CPPUNIT_TEST(testComparatorMethod);
     CPPUNIT_TEST(testDereferenceMethod);
     CPPUNIT_TEST(testEncapsulatedComparatorMethod);
+    CPPUNIT_TEST(testCheckedCastMethod);
+    CPPUNIT_TEST(testReferenceCountMethod);
+    CPPUNIT_TEST(testSelfOwnedAssignMethod);
+    CPPUNIT_TEST(testPublishMethod);
+    CPPUNIT_TEST(testMoveConstructionMethod);
+    CPPUNIT_TEST(testThreeWayComparatorMethod);
+    CPPUNIT_TEST(testOrderedDictionaryMethod);
+    CPPUNIT_TEST(testTotalOrderMethod);
+    CPPUNIT_TEST(testFrozenMethod);
+    CPPUNIT_TEST(testStructuralHashMethod);
+    CPPUNIT_TEST(testLayoutMethod);
 
     CPPUNIT_TEST_SUITE_END();
 
@@ -62,6 +73,17 @@ private:
     void testComparatorMethod();
     void testDereferenceMethod();
     void testEncapsulatedComparatorMethod();
+    void testCheckedCastMethod();
+    void testReferenceCountMethod();
+    void testSelfOwnedAssignMethod();
+    void testPublishMethod();
+    void testMoveConstructionMethod();
+    void testThreeWayComparatorMethod();
+    void testOrderedDictionaryMethod();
+    void testTotalOrderMethod();
+    void testFrozenMethod();
+    void testStructuralHashMethod();
+    void testLayoutMethod();
 };
 
 #endif /* TEST_DYNOBJECTS_GENERIC_H */
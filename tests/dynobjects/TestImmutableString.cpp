@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   TestImmutableString.cpp
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 22:15
+ */
+
+/// Internal libs includes
+
+#include "TestImmutableString.h"
+#include "dynobjects/BasicTypes.h"
+#include "dynobjects/Standard.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <sstream>
+#include <string>
+
+using namespace DynObjects;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestImmutableString);
+
+TestImmutableString::TestImmutableString()
+{
+}
+
+TestImmutableString::~TestImmutableString()
+{
+}
+
+void TestImmutableString::setUp()
+{
+}
+
+void TestImmutableString::tearDown()
+{
+}
+
+void TestImmutableString::testContentMethod()
+{
+    Text pEmpty;
+    CPPUNIT_ASSERT((*pEmpty).empty() && *(*pEmpty).c_str() == '\0');
+
+    Text pShort("KEY_STORE");
+    CPPUNIT_ASSERT((*pShort).size() == 9);
+    CPPUNIT_ASSERT((*pShort).ToString() == "KEY_STORE");
+    CPPUNIT_ASSERT((*pShort).c_str()[9] == '\0');
+    CPPUNIT_ASSERT((*pShort)[4] == 'S');
+    CPPUNIT_ASSERT(std::string((*pShort).begin(), (*pShort).end()) ==
+        "KEY_STORE");
+
+    // Long strings and embedded nulls are kept whole
+    std::string value(300, 'x');
+    value[150] = '\0';
+
+    Text pLong(value);
+    CPPUNIT_ASSERT((*pLong).size() == 300);
+    CPPUNIT_ASSERT((*pLong).ToString() == value);
+    CPPUNIT_ASSERT((*pLong).Equals(value.data(), value.size()));
+    CPPUNIT_ASSERT(!(*pLong).Equals(value.data(), 150));
+
+    Text pPart(value.data(), 10);
+    CPPUNIT_ASSERT((*pPart).ToString() == std::string(10, 'x'));
+
+    // The characters follow the object in its own block
+    CPPUNIT_ASSERT(static_cast<const void *>((*pLong).data()) ==
+                   static_cast<const void *>(&pLong.GetObject() + 1));
+
+    WText pWide(L"KEY_STORE");
+    CPPUNIT_ASSERT((*pWide).ToString() == L"KEY_STORE");
+
+#if __cplusplus >= 201703L
+    std::string_view view = *pShort;
+    CPPUNIT_ASSERT(view == "KEY_STORE");
+    CPPUNIT_ASSERT(Text(view) == pShort);
+#endif
+
+    std::stringstream ss;
+    ss << pShort;
+    CPPUNIT_ASSERT(ss.str() == "KEY_STORE");
+
+    // Copies share the string
+    Text pCopy(pShort);
+    CPPUNIT_ASSERT(&*pCopy == &*pShort);
+    CPPUNIT_ASSERT(MakeObject<ImmutableString<char>>("KEY_STORE") == pShort);
+}
+
+void TestImmutableString::testCompareMethod()
+{
+    std::string name("KEY_STORE");
+    Text pText(name);
+    String pString(name);
+
+    // Equal to the strings holding the same characters
+    CPPUNIT_ASSERT(ObjectPtr(pText) == ObjectPtr(pString));
+    CPPUNIT_ASSERT(ObjectPtr(pString) == ObjectPtr(pText));
+    CPPUNIT_ASSERT(std::hash<ObjectPtr>()(pText) ==
+        std::hash<ObjectPtr>()(pString));
+
+    // Ordered by characters, as strings are
+    std::string values[] = {"", "KEY", "KEY_STORE", "KEY_STORE2", "PUBLIC"};
+    for(const std::string &a : values)
+    {
+        for(const std::string &b : values)
+        {
+            Ordering expected = Operators::Impl::ToOrdering(a.compare(b));
+
+            CPPUNIT_ASSERT(Text(a).compare(Text(b)) == expected);
+            CPPUNIT_ASSERT(Text(a).compare(String(b)) == expected);
+            CPPUNIT_ASSERT(String(a).compare(Text(b)) == expected);
+        }
+    }
+
+    // Among other types, in the place of strings
+    Integer pInteger(1);
+    CPPUNIT_ASSERT(pText.compare(pInteger) == pString.compare(pInteger));
+    CPPUNIT_ASSERT(pInteger.compare(pText) == pInteger.compare(pString));
+    CPPUNIT_ASSERT(ObjectPtr(pText) != ObjectPtr(pInteger));
+}
+
+void TestImmutableString::testDictionaryMethod()
+{
+    Dictionary pContext;
+    (*pContext)[Text("KEY_STORE")] = Integer(1);
+    (*pContext)[String("KEY_STORE")] = Integer(2);
+    (*pContext)[String("PUBLIC")] = Integer(3);
+
+    CPPUNIT_ASSERT((*pContext).size() == 2);
+    CPPUNIT_ASSERT((*pContext).at(Text("KEY_STORE")) == Integer(2));
+    CPPUNIT_ASSERT((*pContext).at(Text("PUBLIC")) == Integer(3));
+
+    // Raw keys find immutable strings
+    Dictionary pOther;
+    (*pOther)[Text("KEY_STORE")] = Integer(1);
+
+    CPPUNIT_ASSERT((*pOther).at(std::string("KEY_STORE")) == Integer(1));
+    CPPUNIT_ASSERT((*pOther).find("KEY_STORE") != (*pOther).end());
+    CPPUNIT_ASSERT((*pOther).find("KEY") == (*pOther).end());
+    CPPUNIT_ASSERT((*pOther).find(1) == (*pOther).end());
+    CPPUNIT_ASSERT(ObjectPtr(pContext) != ObjectPtr(pOther));
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   TestImmutableString.h
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 22:15
+ */
+
+#ifndef TEST_DYNOBJECTS_IMMUTABLE_STRING_H
+#define TEST_DYNOBJECTS_IMMUTABLE_STRING_H
+
+/// Internal libs includes
+#include "dynobjects/ImmutableString.h"
+
+/// External libs includes
+
+// CppUnit
+#include <cppunit/extensions/HelperMacros.h>
+
+class TestImmutableString : public CPPUNIT_NS::TestFixture
+{
+private:
+
+    /// Test registration
+
+    CPPUNIT_TEST_SUITE(TestImmutableString);
+
+    CPPUNIT_TEST(testContentMethod);
+    CPPUNIT_TEST(testCompareMethod);
+    CPPUNIT_TEST(testDictionaryMethod);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    TestImmutableString();
+    virtual ~TestImmutableString();
+    void setUp();
+    void tearDown();
+
+private:
+    void testContentMethod();
+    void testCompareMethod();
+    void testDictionaryMethod();
+};
+
+#endif /* TEST_DYNOBJECTS_IMMUTABLE_STRING_H */
+
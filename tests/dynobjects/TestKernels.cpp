@@ -0,0 +1,212 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   TestKernels.cpp
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 19:20
+ */
+
+/// Internal libs includes
+
+#include "TestKernels.h"
+#include "dynobjects/BasicTypes.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+using namespace DynObjects;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestKernels);
+
+namespace
+{
+    /**
+     * Kernel implementations to check, from the reference one
+     */
+    const Kernels::Level Levels[] =
+    {
+        Kernels::Level::Scalar, Kernels::Level::SSE2, Kernels::Level::AVX2
+    };
+}
+
+TestKernels::TestKernels()
+{
+}
+
+TestKernels::~TestKernels()
+{
+}
+
+void TestKernels::setUp()
+{
+}
+
+void TestKernels::tearDown()
+{
+    Kernels::SetLevel(Kernels::Level::AVX2);
+}
+
+void TestKernels::testHashMethod()
+{
+    std::vector<unsigned char> bytes(300);
+    std::vector<double> doubles(40);
+    std::vector<float> floats(40);
+
+    for(size_t i = 0; i < bytes.size(); ++i)
+    {
+        bytes[i] = static_cast<unsigned char>(i * 131 + 7);
+    }
+
+    for(size_t i = 0; i < doubles.size(); ++i)
+    {
+        doubles[i] = i % 3 ? i * 0.5 : -0.0;
+        floats[i] = i % 3 ? i * 0.5f : -0.0f;
+    }
+
+    std::vector<size_t> reference;
+    for(Kernels::Level level : Levels)
+    {
+        Kernels::SetLevel(level);
+
+        std::vector<size_t> hashes;
+        for(size_t size = 0; size <= bytes.size(); ++size)
+        {
+            hashes.push_back(Kernels::HashBytes(bytes.data(), size));
+        }
+
+        for(size_t size = 0; size <= doubles.size(); ++size)
+        {
+            hashes.push_back(Kernels::HashDoubles(doubles.data(), size));
+            hashes.push_back(Kernels::HashFloats(floats.data(), size));
+        }
+
+        if(reference.empty())
+        {
+            reference = hashes;
+        }
+
+        CPPUNIT_ASSERT(hashes == reference);
+    }
+
+    // Zeros of both signs hash the same, short and long arrays
+    for(size_t size : {size_t(3), doubles.size()})
+    {
+        std::vector<double> positive(doubles.begin(), doubles.begin() + size);
+        std::vector<float> positiveFloats(floats.begin(),
+                                          floats.begin() + size);
+        for(size_t i = 0; i < size; ++i)
+        {
+            positive[i] = positive[i] == 0.0 ? 0.0 : positive[i];
+            positiveFloats[i] = positiveFloats[i] == 0.0f ? 0.0f :
+                positiveFloats[i];
+        }
+
+        CPPUNIT_ASSERT(Kernels::HashDoubles(positive.data(), size) ==
+            Kernels::HashDoubles(doubles.data(), size));
+        CPPUNIT_ASSERT(Kernels::HashFloats(positiveFloats.data(), size) ==
+            Kernels::HashFloats(floats.data(), size));
+    }
+
+    // Swapping two stripes changes the hash
+    std::vector<unsigned char> swapped(bytes);
+    std::swap_ranges(swapped.begin(), swapped.begin() + 32,
+                     swapped.begin() + 32);
+    CPPUNIT_ASSERT(Kernels::HashBytes(bytes.data(), 128) !=
+        Kernels::HashBytes(swapped.data(), 128));
+    CPPUNIT_ASSERT(Kernels::HashBytes(bytes.data(), 128) !=
+        Kernels::HashBytes(bytes.data(), 129));
+}
+
+void TestKernels::testMismatchMethod()
+{
+    std::vector<unsigned char> bytes(200, 'X');
+    std::vector<double> doubles(50, 1.5);
+    std::vector<float> floats(50, 1.5f);
+
+    for(Kernels::Level level : Levels)
+    {
+        Kernels::SetLevel(level);
+
+        CPPUNIT_ASSERT(Kernels::MismatchBytes(bytes.data(), bytes.data(),
+            bytes.size()) == bytes.size());
+
+        for(size_t i = 0; i < bytes.size(); ++i)
+        {
+            std::vector<unsigned char> other(bytes);
+            other[i] = 'Y';
+            CPPUNIT_ASSERT(Kernels::MismatchBytes(bytes.data(), other.data(),
+                bytes.size()) == i);
+        }
+
+        for(size_t i = 0; i < doubles.size(); ++i)
+        {
+            std::vector<double> other(doubles);
+            other[i] = 2.5;
+            CPPUNIT_ASSERT(Kernels::Mismatch(doubles.data(), other.data(),
+                doubles.size()) == i);
+
+            std::vector<float> otherFloats(floats);
+            otherFloats[i] = std::numeric_limits<float>::quiet_NaN();
+            CPPUNIT_ASSERT(Kernels::Mismatch(otherFloats.data(),
+                otherFloats.data(), floats.size()) == i);
+        }
+
+        std::vector<double> zeros(9, 0.0);
+        std::vector<double> negativeZeros(9, -0.0);
+        CPPUNIT_ASSERT(Kernels::Mismatch(zeros.data(), negativeZeros.data(),
+            zeros.size()) == zeros.size());
+
+        std::vector<int> values(40, -1);
+        std::vector<int> others(values);
+        others[37] = 1;
+        CPPUNIT_ASSERT(Kernels::Mismatch(values.data(), others.data(),
+            values.size()) == 37);
+    }
+}
+
+void TestKernels::testArrayComparatorMethod()
+{
+    Vector<int> pValues(std::vector<int>(100, -1));
+    Vector<int> pGreater(std::vector<int>(100, -1));
+    (*pGreater)[70] = 1;
+
+    CPPUNIT_ASSERT(ObjectPtr(pValues).compare(pGreater) == Ordering::Less);
+    CPPUNIT_ASSERT(ObjectPtr(pGreater).compare(pValues) == Ordering::Greater);
+    (*pGreater).resize(70);
+    CPPUNIT_ASSERT(ObjectPtr(pGreater).compare(pValues) == Ordering::Less);
+
+    Vector<double> pDoubles(std::vector<double>(100, 0.0));
+    Vector<double> pNegative(std::vector<double>(100, -0.0));
+    CPPUNIT_ASSERT(ObjectPtr(pDoubles) == ObjectPtr(pNegative));
+    CPPUNIT_ASSERT(std::hash<ObjectPtr>()(pDoubles) ==
+        std::hash<ObjectPtr>()(pNegative));
+
+    (*pNegative)[99] = std::numeric_limits<double>::quiet_NaN();
+    CPPUNIT_ASSERT(ObjectPtr(pDoubles).compare(pNegative) ==
+        Ordering::Unordered);
+
+    Dictionary pContext;
+    (*pContext)[Vector<double>(std::vector<double>(100, 0.5))] = Integer(1);
+    CPPUNIT_ASSERT((*pContext).at(
+        Vector<double>(std::vector<double>(100, 0.5))) == Integer(1));
+}
\ No newline at end of file
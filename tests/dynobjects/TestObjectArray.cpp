@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   TestObjectArray.cpp
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 20:10
+ */
+
+/// Internal libs includes
+
+#include "TestObjectArray.h"
+#include "dynobjects/Standard.h"
+#include "dynobjects/BasicTypes.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <typeinfo>
+#include <vector>
+
+using namespace DynObjects;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestObjectArray);
+
+TestObjectArray::TestObjectArray()
+{
+}
+
+TestObjectArray::~TestObjectArray()
+{
+}
+
+void TestObjectArray::setUp()
+{
+}
+
+void TestObjectArray::tearDown()
+{
+}
+
+void TestObjectArray::testSpanMethod()
+{
+    DoubleArray pArray(std::vector<double>{1.5, 2.5, 3.5});
+    ObjectArray<double> &array = pArray.GetObject();
+
+    CPPUNIT_ASSERT(array.GetSize() == 3);
+    CPPUNIT_ASSERT(array.GetSpan().data() == (*pArray).data());
+
+    // Spans write through to the array
+    ArraySpan<double> span = array.GetSpan();
+    for(double &item : span)
+    {
+        item *= 2;
+    }
+
+    CPPUNIT_ASSERT((*pArray) == std::vector<double>({3.0, 5.0, 7.0}));
+
+    ArraySpan<const double> items = array.GetSpan();
+    CPPUNIT_ASSERT(std::accumulate(items.begin(), items.end(), 0.0) == 15.0);
+
+    // Arrays built from spans copy the items
+    Int32Array pEmpty;
+    CPPUNIT_ASSERT(pEmpty.GetObject().GetSpan().empty());
+
+    std::vector<int32_t> values(10, 7);
+    Int32Array pValues(ArraySpan<const int32_t>(values.data(), values.size()));
+    values[0] = 0;
+    CPPUNIT_ASSERT((*pValues)[0] == 7);
+    CPPUNIT_ASSERT(pValues.GetObject().GetSize() == 10);
+}
+
+void TestObjectArray::testBoxedMethod()
+{
+    Int64Array pArray(std::vector<int64_t>{10, 20, 30});
+    const ObjectArray<int64_t> &array = pArray.GetObject();
+
+    CPPUNIT_ASSERT(array.GetItem(1) == Int64(20));
+    CPPUNIT_ASSERT_THROW(array.GetItem(3), std::out_of_range);
+
+    std::vector<ObjectPtr> boxed(array.GetBoxed().begin(),
+                                 array.GetBoxed().end());
+    CPPUNIT_ASSERT(boxed.size() == 3);
+    CPPUNIT_ASSERT(boxed[2] == Int64(30));
+    CPPUNIT_ASSERT(array.GetBoxed()[0] == Int64(10));
+
+    // Boxed items are copies
+    Int64 pItem = array.GetItem(0);
+    *pItem = 15;
+    CPPUNIT_ASSERT((*pArray)[0] == 10);
+
+    pArray.GetObject().SetItem(0, pItem);
+    CPPUNIT_ASSERT((*pArray)[0] == 15);
+    CPPUNIT_ASSERT_THROW(pArray.GetObject().SetItem(0, Integer(1)),
+                         std::bad_cast);
+}
+
+void TestObjectArray::testCompareMethod()
+{
+    DoubleArray pValues(std::vector<double>(100, 0.5));
+    DoubleArray pGreater(std::vector<double>(100, 0.5));
+    (*pGreater)[60] = 1.5;
+
+    CPPUNIT_ASSERT(ObjectPtr(pValues).compare(pGreater) == Ordering::Less);
+    CPPUNIT_ASSERT(ObjectPtr(pGreater).compare(pValues) == Ordering::Greater);
+
+    (*pGreater)[60] = 0.5;
+    CPPUNIT_ASSERT(ObjectPtr(pValues) == ObjectPtr(pGreater));
+    CPPUNIT_ASSERT(std::hash<ObjectPtr>()(pValues) ==
+        std::hash<ObjectPtr>()(pGreater));
+
+    (*pGreater)[60] = std::numeric_limits<double>::quiet_NaN();
+    CPPUNIT_ASSERT(ObjectPtr(pValues).compare(pGreater) ==
+        Ordering::Unordered);
+
+    // Arrays are never equal to boxed vectors of the same numbers
+    Vector<double> pVector(std::vector<double>(100, 0.5));
+    CPPUNIT_ASSERT(ObjectPtr(pValues) != ObjectPtr(pVector));
+
+    Dictionary pContext;
+    (*pContext)[pValues] = Integer(1);
+    (*pContext)[pVector] = Integer(2);
+    CPPUNIT_ASSERT((*pContext).size() == 2);
+    CPPUNIT_ASSERT((*pContext).at(
+        DoubleArray(std::vector<double>(100, 0.5))) == Integer(1));
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   TestObjectArray.h
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 20:10
+ */
+
+#ifndef TEST_DYNOBJECTS_OBJECTARRAY_H
+#define TEST_DYNOBJECTS_OBJECTARRAY_H
+
+/// Internal libs includes
+#include "dynobjects/ObjectArray.h"
+
+/// External libs includes
+
+// CppUnit
+#include <cppunit/extensions/HelperMacros.h>
+
+class TestObjectArray : public CPPUNIT_NS::TestFixture
+{
+private:
+
+    /// Test registration
+
+    CPPUNIT_TEST_SUITE(TestObjectArray);
+
+    CPPUNIT_TEST(testSpanMethod);
+    CPPUNIT_TEST(testBoxedMethod);
+    CPPUNIT_TEST(testCompareMethod);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    TestObjectArray();
+    virtual ~TestObjectArray();
+    void setUp();
+    void tearDown();
+
+private:
+    void testSpanMethod();
+    void testBoxedMethod();
+    void testCompareMethod();
+};
+
+#endif /* TEST_DYNOBJECTS_OBJECTARRAY_H */
+
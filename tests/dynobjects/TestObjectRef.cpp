@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   TestObjectRef.cpp
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 23:59
+ */
+
+/// Internal libs includes
+
+#include "TestObjectRef.h"
+#include "dynobjects/BasicTypes.h"
+#include "dynobjects/Standard.h"
+#include "dynobjects/Visitor.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <functional>
+#include <sstream>
+#include <string>
+#include <typeinfo>
+#include <unordered_set>
+
+using namespace DynObjects;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestObjectRef);
+
+namespace
+{
+    typedef InstanceRef<int, Basic<int>> IntegerRef;
+    typedef InstanceRef<Dictionary::value_type, Dictionary::object_type>
+        DictionaryRef;
+}
+
+TestObjectRef::TestObjectRef()
+{
+}
+
+TestObjectRef::~TestObjectRef()
+{
+}
+
+void TestObjectRef::setUp()
+{
+}
+
+void TestObjectRef::tearDown()
+{
+}
+
+void TestObjectRef::testObjectRefMethod()
+{
+    CPPUNIT_ASSERT(!ObjectRef());
+    CPPUNIT_ASSERT(!ObjectRef(ObjectPtr()));
+
+    ObjectPtr pText = String("TEXT");
+    ObjectPtr pOther = String("OTHER");
+    ObjectPtr pNumber = Integer(7);
+
+    ObjectRef text = pText;
+    CPPUNIT_ASSERT(text && &*text == &*pText);
+    CPPUNIT_ASSERT(ObjectRef(*pText) == text);
+
+    // Compares and hashes as the object pointer
+    CPPUNIT_ASSERT(text.hash() == std::hash<ObjectPtr>()(pText));
+    CPPUNIT_ASSERT(std::hash<ObjectRef>()(text) == text.hash());
+    CPPUNIT_ASSERT(text.compare(pOther) == pText.compare(pOther));
+    CPPUNIT_ASSERT(text.compare(pNumber) == pText.compare(pNumber));
+    CPPUNIT_ASSERT(text == String("TEXT"));
+    CPPUNIT_ASSERT(text != pOther);
+    CPPUNIT_ASSERT(pOther < text && text > pOther);
+    CPPUNIT_ASSERT(pText <= text && text >= pText);
+
+    // Inline values are referenced inside their pointer
+    ObjectRef number = pNumber;
+    CPPUNIT_ASSERT(number == Integer(7));
+    CPPUNIT_ASSERT(number.hash() == std::hash<ObjectPtr>()(pNumber));
+
+    std::unordered_set<ObjectPtr> set = {pText, pNumber};
+    CPPUNIT_ASSERT(set.count(pText) == 1);
+
+    std::ostringstream os;
+    os << ObjectRef() << ' ' << text;
+    CPPUNIT_ASSERT(os.str() == "<NULL> " + (*pText).str());
+
+    // Visitors take references as well
+    CPPUNIT_ASSERT(Visit(number, Overload(
+        [](int value) { return value; },
+        [](const Object &) { return 0; })) == 7);
+    CPPUNIT_ASSERT_THROW(Visit(ObjectRef(), Overload(
+        [](const Object &) { return 0; })), std::bad_cast);
+}
+
+void TestObjectRef::testInstanceRefMethod()
+{
+    Integer pOne(1);
+    Integer pTwo(2);
+    ObjectPtr pText = String("TEXT");
+
+    IntegerRef one = pOne;
+    IntegerRef two(static_cast<ObjectPtr &>(pTwo));
+
+    CPPUNIT_ASSERT(*one == 1 && *two == 2);
+    CPPUNIT_ASSERT(&one.GetObject() == &pOne.GetObject());
+    CPPUNIT_ASSERT(one < two && two > one && one != two);
+    CPPUNIT_ASSERT(one == IntegerRef(Integer(1)));
+    CPPUNIT_ASSERT(one.compare(two) == pOne.compare(pTwo));
+    CPPUNIT_ASSERT(one.hash() == pOne.hash());
+    CPPUNIT_ASSERT(std::hash<IntegerRef>()(two) ==
+                   std::hash<Integer>()(pTwo));
+
+    // Still compares with other types through the object interface
+    CPPUNIT_ASSERT(one.compare(pText) == pOne.compare(pText));
+
+    InstanceRef<std::string, Generic<std::string>> text(pText);
+    CPPUNIT_ASSERT(*text == "TEXT");
+    CPPUNIT_ASSERT((*text).size() == 4);
+
+#if DYNOBJECTS_CHECKED_CAST
+    IntegerRef wrong(pText);
+    CPPUNIT_ASSERT_THROW(*wrong, std::bad_cast);
+#endif
+}
+
+void TestObjectRef::testReferenceCountMethod()
+{
+    Dictionary pContext;
+    (*pContext)[String("KEY")] = String("VALUE");
+
+    ObjectPtr pRoot = pContext;
+    ObjectRef root = pRoot;
+
+    size_t hash = root.hash();
+    DictionaryRef typed(root);
+    CPPUNIT_ASSERT(hash == typed.hash());
+    CPPUNIT_ASSERT((*typed).size() == 1);
+    CPPUNIT_ASSERT(typed == DictionaryRef(pContext));
+
+#ifdef DYNOBJECTS_INTRUSIVE_REFCOUNT
+    // Borrowing, re-typing and comparing do not touch the count
+    CPPUNIT_ASSERT(pContext.GetObject().GetRefCount() == 2);
+#else
+    CPPUNIT_ASSERT(std::shared_ptr<Object>(pRoot).use_count() == 3);
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,231 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   TestRecord.cpp
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 20:45
+ */
+
+/// Internal libs includes
+
+#include "TestRecord.h"
+#include "dynobjects/Standard.h"
+#include "dynobjects/BasicTypes.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace DynObjects;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestRecord);
+
+TestRecord::TestRecord()
+{
+}
+
+TestRecord::~TestRecord()
+{
+}
+
+void TestRecord::setUp()
+{
+}
+
+void TestRecord::tearDown()
+{
+}
+
+void TestRecord::testShapeMethod()
+{
+    const Shape &root = Shape::GetRoot();
+    const Shape &name = root.AddField("name");
+    const Shape &age = name.AddField("age");
+
+    CPPUNIT_ASSERT(root.GetSize() == 0);
+    CPPUNIT_ASSERT(age.GetSize() == 2);
+    CPPUNIT_ASSERT(age.GetParent() == &name);
+    CPPUNIT_ASSERT(age.GetFieldName(1) == "age");
+    CPPUNIT_ASSERT(age.FindField("name") == 0);
+    CPPUNIT_ASSERT(age.FindField("size") == Shape::NoField);
+
+    // Transitions are shared, adding a known field changes nothing
+    CPPUNIT_ASSERT(&root.AddField("name").AddField("age") == &age);
+    CPPUNIT_ASSERT(&age.AddField("name") == &age);
+    CPPUNIT_ASSERT(&root.AddField("age").AddField("name") != &age);
+
+    CPPUNIT_ASSERT(age.GetSortedFields() == std::vector<uint32_t>({1, 0}));
+    CPPUNIT_ASSERT(age.GetId() != name.GetId());
+}
+
+void TestRecord::testFieldMethod()
+{
+    static const FieldKey Name("name");
+    static const FieldKey Size("size");
+
+    RecordInstance pRecord;
+    (*pRecord).Set("name", String("Mario"));
+    (*pRecord).Set(Size, Integer(3));
+
+    CPPUNIT_ASSERT((*pRecord).GetSize() == 2);
+    CPPUNIT_ASSERT(&(*pRecord).GetShape() ==
+        &Shape::GetRoot().AddField("name").AddField("size"));
+    CPPUNIT_ASSERT((*pRecord).Get(Name) == String("Mario"));
+    CPPUNIT_ASSERT((*pRecord).Get("size") == Integer(3));
+    CPPUNIT_ASSERT((*pRecord).GetField(1) == Integer(3));
+    CPPUNIT_ASSERT((*pRecord).Has(Name));
+    CPPUNIT_ASSERT(!(*pRecord).Has("age"));
+    CPPUNIT_ASSERT_THROW((*pRecord).Get("age"), std::out_of_range);
+
+    // Setting a known field keeps the shape
+    const Shape *shape = &(*pRecord).GetShape();
+    (*pRecord).Set(Name, String("Salazar"));
+    CPPUNIT_ASSERT(&(*pRecord).GetShape() == shape);
+    CPPUNIT_ASSERT((*pRecord).Get("name") == String("Salazar"));
+
+    // Keys find fields of records of other shapes
+    RecordInstance pOther;
+    (*pOther).Set(Size, Integer(4));
+    (*pOther).Set(Name, String("Other"));
+    CPPUNIT_ASSERT((*pOther).Get(Name) == String("Other"));
+    CPPUNIT_ASSERT((*pRecord).Get(Name) == String("Salazar"));
+    CPPUNIT_ASSERT((*pOther).GetField(0) == Integer(4));
+
+    // Records built from a shape
+    RecordInstance pBuilt(*shape, std::vector<ObjectPtr>{String("A"),
+        Integer(1)});
+    CPPUNIT_ASSERT((*pBuilt).Get(Size) == Integer(1));
+    CPPUNIT_ASSERT_THROW(Record(*shape, std::vector<ObjectPtr>()),
+                         std::invalid_argument);
+}
+
+void TestRecord::testCompareMethod()
+{
+    RecordInstance pRecord;
+    (*pRecord).Set("name", String("Mario"));
+    (*pRecord).Set("size", Integer(3));
+
+    RecordInstance pOther;
+    (*pOther).Set("size", Integer(3));
+    (*pOther).Set("name", String("Mario"));
+
+    // Field order does not matter
+    CPPUNIT_ASSERT(&(*pRecord).GetShape() != &(*pOther).GetShape());
+    CPPUNIT_ASSERT(ObjectPtr(pRecord) == ObjectPtr(pOther));
+    CPPUNIT_ASSERT(std::hash<ObjectPtr>()(pRecord) ==
+        std::hash<ObjectPtr>()(pOther));
+
+    (*pOther).Set("size", Integer(4));
+    CPPUNIT_ASSERT(ObjectPtr(pRecord).compare(pOther) == Ordering::Less);
+
+    (*pOther).Set("size", Integer(3));
+    (*pOther).Set("age", Integer(1));
+    CPPUNIT_ASSERT(ObjectPtr(pRecord).compare(pOther) == Ordering::Greater);
+
+    RecordInstance pCopy(*pRecord);
+    CPPUNIT_ASSERT(ObjectPtr(pCopy) == ObjectPtr(pRecord));
+    CPPUNIT_ASSERT(ObjectPtr(pCopy) != ObjectPtr(String("Mario")));
+
+    Dictionary pContext;
+    (*pContext)[pRecord] = Integer(1);
+    (*pContext)[pOther] = Integer(2);
+    CPPUNIT_ASSERT((*pContext).size() == 2);
+    CPPUNIT_ASSERT((*pContext).at(pCopy) == Integer(1));
+}
+
+void TestRecord::testOwnedShapeMethod()
+{
+    const Shape &base = Shape::GetRoot().AddField("base");
+    const size_t count = Shape::MaxTransitions + 8;
+    std::vector<RecordInstance> records;
+
+    // Past the transitions cap records get shapes of their own
+    for(size_t i = 0; i < count; ++i)
+    {
+        RecordInstance pRecord;
+        (*pRecord).Set("base", Integer(0));
+        (*pRecord).Set("field " + std::to_string(i), Integer(int(i)));
+        records.push_back(pRecord);
+    }
+
+    const RecordInstance &pFirst = records.front();
+    const RecordInstance &pLast = records.back();
+    const std::string name = "field " + std::to_string(count - 1);
+
+    CPPUNIT_ASSERT((*pFirst).GetShape().IsShared());
+    CPPUNIT_ASSERT(!(*pLast).GetShape().IsShared());
+    CPPUNIT_ASSERT((*pLast).GetShape().GetId() == 0);
+    CPPUNIT_ASSERT((*pLast).Get(name) == Integer(int(count - 1)));
+    CPPUNIT_ASSERT(base.TryAddField("other") == nullptr);
+    CPPUNIT_ASSERT(base.TryAddField("field 0") != nullptr);
+    CPPUNIT_ASSERT_THROW(base.AddField("other"), std::length_error);
+
+    // They compare and hash as records with shared shapes
+    RecordInstance pShared;
+    (*pShared).Set(name, Integer(int(count - 1)));
+    (*pShared).Set("base", Integer(0));
+
+    CPPUNIT_ASSERT((*pShared).GetShape().IsShared());
+    CPPUNIT_ASSERT(pShared == pLast && pShared.hash() == pLast.hash());
+
+    // Copies keep their shape, the record grows its own in place
+    static const FieldKey Extra("extra");
+    Record copy(*pLast);
+    copy.Set(Extra, Integer(1));
+
+    const Shape *shape = &copy.GetShape();
+    copy.Set("more", Integer(2));
+
+    CPPUNIT_ASSERT(&copy.GetShape() == shape);
+    CPPUNIT_ASSERT(copy.Get(Extra) == Integer(1));
+    CPPUNIT_ASSERT(copy.Get("more") == Integer(2));
+    CPPUNIT_ASSERT(copy.GetSize() == (*pLast).GetSize() + 2);
+    CPPUNIT_ASSERT(!(*pLast).Has(Extra) && !(*pLast).Has("more"));
+}
+
+void TestRecord::testSharedCountMethod()
+{
+    const size_t count = 300;
+    RecordInstance pLast;
+
+    // Field names taken from data do not grow the shapes tree unbounded
+    for(size_t i = 0; i < count; ++i)
+    {
+        for(size_t j = 0; j < count; ++j)
+        {
+            pLast = RecordInstance();
+            (*pLast).Set("key " + std::to_string(i), Integer(int(i)));
+            (*pLast).Set("value " + std::to_string(j), Integer(int(j)));
+        }
+    }
+
+    CPPUNIT_ASSERT(Shape::GetSharedCount() == Shape::MaxShapes);
+    CPPUNIT_ASSERT(!(*pLast).GetShape().IsShared());
+    CPPUNIT_ASSERT((*pLast).Get("value " + std::to_string(count - 1)) ==
+        Integer(int(count - 1)));
+
+    // Shapes with room for more children can not have them either
+    const Shape &shape = Shape::GetRoot().AddField("key 0").AddField(
+        "value 0");
+    CPPUNIT_ASSERT(shape.IsShared());
+    CPPUNIT_ASSERT(shape.TryAddField("other") == nullptr);
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   TestRecord.h
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 20:45
+ */
+
+#ifndef TEST_DYNOBJECTS_RECORD_H
+#define TEST_DYNOBJECTS_RECORD_H
+
+/// Internal libs includes
+#include "dynobjects/Record.h"
+
+/// External libs includes
+
+// CppUnit
+#include <cppunit/extensions/HelperMacros.h>
+
+class TestRecord : public CPPUNIT_NS::TestFixture
+{
+private:
+
+    /// Test registration
+
+    CPPUNIT_TEST_SUITE(TestRecord);
+
+    CPPUNIT_TEST(testShapeMethod);
+    CPPUNIT_TEST(testFieldMethod);
+    CPPUNIT_TEST(testCompareMethod);
+    CPPUNIT_TEST(testOwnedShapeMethod);
+    CPPUNIT_TEST(testSharedCountMethod);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    TestRecord();
+    virtual ~TestRecord();
+    void setUp();
+    void tearDown();
+
+private:
+    void testShapeMethod();
+    void testFieldMethod();
+    void testCompareMethod();
+    void testOwnedShapeMethod();
+    void testSharedCountMethod();
+};
+
+#endif /* TEST_DYNOBJECTS_RECORD_H */
+
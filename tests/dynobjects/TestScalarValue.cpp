@@ -0,0 +1,232 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   TestScalarValue.cpp
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 23:55
+ */
+
+/// Internal libs includes
+
+#include "TestScalarValue.h"
+#include "dynobjects/BasicTypes.h"
+#include "dynobjects/Standard.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <unordered_set>
+#include <vector>
+
+using namespace DynObjects;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestScalarValue);
+
+namespace
+{
+    // Built at compile time
+    constexpr ScalarValue Answer(42);
+    static_assert(Answer.Is<int>() && !Answer.IsNull(),
+                  "ScalarValue is not a literal type");
+    static_assert(std::is_trivially_copyable<ScalarValue>::value,
+                  "ScalarValue is not trivially copyable");
+}
+
+TestScalarValue::TestScalarValue()
+{
+}
+
+TestScalarValue::~TestScalarValue()
+{
+}
+
+void TestScalarValue::setUp()
+{
+}
+
+void TestScalarValue::tearDown()
+{
+}
+
+void TestScalarValue::testScalarMethod()
+{
+    CPPUNIT_ASSERT(sizeof(ScalarValue) <= 3 * sizeof(uint64_t));
+
+    ScalarValue empty;
+    CPPUNIT_ASSERT(empty.IsNull());
+    CPPUNIT_ASSERT(empty.GetKind() == ScalarValue::Kind::Null);
+    CPPUNIT_ASSERT(ScalarValue(nullptr).IsNull());
+
+    CPPUNIT_ASSERT(Answer.Get<int>() == 42);
+    CPPUNIT_ASSERT(ScalarValue(true).Get<bool>());
+    CPPUNIT_ASSERT(ScalarValue('a').Get<char>() == 'a');
+    CPPUNIT_ASSERT(ScalarValue(int8_t(-3)).Get<int8_t>() == -3);
+    CPPUNIT_ASSERT(ScalarValue(uint16_t(7)).Get<uint16_t>() == 7);
+    CPPUNIT_ASSERT(ScalarValue(int64_t(1) << 40).Get<int64_t>() ==
+                   int64_t(1) << 40);
+    CPPUNIT_ASSERT(ScalarValue(UINT64_MAX).Get<uint64_t>() == UINT64_MAX);
+    CPPUNIT_ASSERT(ScalarValue(0.5f).Get<float>() == 0.5f);
+    CPPUNIT_ASSERT(ScalarValue(-1.5).Get<double>() == -1.5);
+
+    // Items keep their exact type
+    CPPUNIT_ASSERT(ScalarValue('a').Is<char>());
+    CPPUNIT_ASSERT(!ScalarValue('a').Is<int>());
+    CPPUNIT_ASSERT(ScalarValue(1u).Is<unsigned int>());
+    CPPUNIT_ASSERT_THROW(Answer.Get<long>(), std::bad_cast);
+    CPPUNIT_ASSERT_THROW(empty.Get<int>(), std::bad_cast);
+
+    // Short strings are stored inline, nothing is interned
+    size_t symbols = Symbol::GetCount();
+    ScalarValue text("scalar");
+    CPPUNIT_ASSERT(text.IsString() && text.GetString() == "scalar");
+    CPPUNIT_ASSERT(ScalarValue(std::string("scalar")) == text);
+    CPPUNIT_ASSERT(ScalarValue("scalar value", 6) == text);
+    CPPUNIT_ASSERT(ScalarValue("").GetString().empty());
+    CPPUNIT_ASSERT(Symbol::GetCount() == symbols);
+    CPPUNIT_ASSERT_THROW(ScalarValue(std::string(
+        ScalarValue::MaxStringSize + 1, 'x')), std::length_error);
+    CPPUNIT_ASSERT_THROW(Answer.GetString(), std::bad_cast);
+
+    // Copies own the item
+    ScalarValue copy = text;
+    CPPUNIT_ASSERT(copy == text && copy.GetString() == "scalar");
+
+    // Symbols are only interned by the caller
+    ScalarValue name(Symbol("scalar"));
+    CPPUNIT_ASSERT(name.Is<Symbol>() && !name.IsString());
+    CPPUNIT_ASSERT(name.Get<Symbol>() == Symbol("scalar"));
+    CPPUNIT_ASSERT(name != text);
+    CPPUNIT_ASSERT_THROW(name.GetString(), std::bad_cast);
+}
+
+void TestScalarValue::testObjectMethod()
+{
+    CPPUNIT_ASSERT(ScalarValue(ObjectPtr()).IsNull());
+    CPPUNIT_ASSERT(!ScalarValue().ToObject());
+
+    ScalarValue number(Integer(3));
+    CPPUNIT_ASSERT(number.Is<int>() && number.Get<int>() == 3);
+    CPPUNIT_ASSERT(ScalarValue(Int8(-1)).Is<int8_t>());
+    CPPUNIT_ASSERT(ScalarValue(UInt64(9)).Get<uint64_t>() == 9);
+    CPPUNIT_ASSERT(ScalarValue(Boolean(true)).Get<bool>());
+    CPPUNIT_ASSERT(ScalarValue(Double(0.25)).Get<double>() == 0.25);
+    CPPUNIT_ASSERT(ScalarValue(String("text")).GetString() == "text");
+    CPPUNIT_ASSERT(ScalarValue(Atom(Symbol("text"))).Is<Symbol>());
+
+    // Values box back into the objects they were built from
+    const std::vector<ObjectPtr> objects = {
+        Char('x'), Short(-2), Integer(3), Long(-4), UChar(5), UShort(6),
+        UInteger(7), ULong(8), Boolean(false), Float(1.5f), Double(2.5),
+        String("text"), Atom(Symbol("text"))};
+
+    for(const ObjectPtr &o : objects)
+    {
+        ObjectPtr boxed = ScalarValue(o).ToObject();
+        CPPUNIT_ASSERT((*boxed).GetObjectTypeId() == (*o).GetObjectTypeId());
+        CPPUNIT_ASSERT(*boxed == *o);
+        CPPUNIT_ASSERT(ScalarValue(o).hash() == std::hash<ObjectPtr>()(o));
+    }
+
+    // Only the closed world of scalars is allowed
+    CPPUNIT_ASSERT_THROW(ScalarValue(Vector<ObjectPtr>()), std::bad_cast);
+    CPPUNIT_ASSERT_THROW(ScalarValue(WString(L"text")), std::bad_cast);
+    CPPUNIT_ASSERT_THROW(ScalarValue(String("longer than a scalar")),
+                         std::length_error);
+
+    // Objects that are not scalar values are told apart without throwing
+    const std::string fits(ScalarValue::MaxStringSize, 'x');
+    const std::string longer(ScalarValue::MaxStringSize + 1, 'x');
+    ScalarValue value(7);
+
+    CPPUNIT_ASSERT(ScalarValue::TryFromObject(String(fits), value));
+    CPPUNIT_ASSERT(value.GetString() == fits);
+    CPPUNIT_ASSERT(ScalarValue(String(fits)) == value);
+    CPPUNIT_ASSERT(!ScalarValue::TryFromObject(String(longer), value));
+    CPPUNIT_ASSERT(value.GetString() == fits);
+    CPPUNIT_ASSERT_THROW(ScalarValue(String(longer)), std::length_error);
+    CPPUNIT_ASSERT_THROW(ScalarValue(longer.data(), longer.size()),
+                         std::length_error);
+    CPPUNIT_ASSERT(!ScalarValue::TryFromObject(Vector<ObjectPtr>(), value));
+    CPPUNIT_ASSERT(ScalarValue::TryFromObject(Integer(3), value));
+    CPPUNIT_ASSERT(value.Get<int>() == 3);
+    CPPUNIT_ASSERT(ScalarValue::TryFromObject(ObjectPtr(), value));
+    CPPUNIT_ASSERT(value.IsNull());
+
+    // Strings do not convert implicitly, most do not fit
+    CPPUNIT_ASSERT(!(std::is_convertible<std::string, ScalarValue>::value));
+    CPPUNIT_ASSERT(!(std::is_convertible<const char *, ScalarValue>::value));
+}
+
+void TestScalarValue::testCompareMethod()
+{
+    CPPUNIT_ASSERT(ScalarValue(1) < ScalarValue(2));
+    CPPUNIT_ASSERT(ScalarValue(2.5) >= ScalarValue(2.5));
+    CPPUNIT_ASSERT(ScalarValue("a") < ScalarValue("b"));
+    CPPUNIT_ASSERT(ScalarValue("a") == ScalarValue(std::string("a")));
+    CPPUNIT_ASSERT(ScalarValue() == ScalarValue(nullptr));
+    CPPUNIT_ASSERT(ScalarValue() < ScalarValue(false));
+
+    // Items of different types differ, as their objects do
+    CPPUNIT_ASSERT(ScalarValue(3) != ScalarValue(3L));
+    CPPUNIT_ASSERT(ScalarValue(3) != ScalarValue(3.0));
+
+    // Values order as the objects boxing them
+    std::vector<ObjectPtr> objects = {
+        Double(2.5), Integer(3), String("b"), Long(-4), Integer(-1),
+        Boolean(true), String("a"), Char('x'), Double(-0.5),
+        Atom(Symbol("b")), Atom(Symbol("a"))};
+    std::vector<ScalarValue> values;
+
+    for(const ObjectPtr &o : objects)
+    {
+        values.push_back(ScalarValue(o));
+    }
+
+    std::sort(objects.begin(), objects.end());
+    std::sort(values.begin(), values.end());
+
+    for(size_t i = 0; i < objects.size(); ++i)
+    {
+        CPPUNIT_ASSERT(*values[i].ToObject() == *objects[i]);
+    }
+
+    std::unordered_set<ScalarValue> set(values.begin(), values.end());
+    CPPUNIT_ASSERT(set.size() == values.size());
+    CPPUNIT_ASSERT(set.count(ScalarValue(3)) == 1);
+    CPPUNIT_ASSERT(set.count(ScalarValue("a")) == 1);
+    CPPUNIT_ASSERT(set.count(ScalarValue(3u)) == 0);
+}
+
+void TestScalarValue::testStreamMethod()
+{
+    std::ostringstream os;
+    os << ScalarValue(-7) << ' ' << ScalarValue(0.5) << ' '
+       << ScalarValue(true) << ' ' << ScalarValue('c') << ' '
+       << ScalarValue("text") << ' ' << ScalarValue(Symbol("atom")) << ' '
+       << ScalarValue();
+
+    CPPUNIT_ASSERT(os.str() == "-7 0.5 true c text atom <NULL>");
+}
\ No newline at end of file
@@ -0,0 +1,208 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   TestValue.cpp
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 23:00
+ */
+
+/// Internal libs includes
+
+#include "TestValue.h"
+#include "dynobjects/BasicTypes.h"
+#include "dynobjects/Standard.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <typeinfo>
+#include <unordered_set>
+#include <vector>
+
+using namespace DynObjects;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestValue);
+
+TestValue::TestValue()
+{
+}
+
+TestValue::~TestValue()
+{
+}
+
+void TestValue::setUp()
+{
+}
+
+void TestValue::tearDown()
+{
+}
+
+void TestValue::testScalarMethod()
+{
+    CPPUNIT_ASSERT(sizeof(Value) == sizeof(uint64_t));
+
+    Value empty;
+    CPPUNIT_ASSERT(empty.IsNull() && empty.GetKind() == Value::Kind::Null);
+    CPPUNIT_ASSERT(Value(nullptr).IsNull());
+    CPPUNIT_ASSERT(!empty.ToObject());
+
+    Value yes(true);
+    CPPUNIT_ASSERT(yes.IsBoolean() && yes.AsBoolean());
+    CPPUNIT_ASSERT(!Value(false).AsBoolean());
+
+    Value number(-42);
+    CPPUNIT_ASSERT(number.IsInteger() && number.AsInteger() == -42);
+    CPPUNIT_ASSERT(number.IsNumber() && number.AsNumber() == -42.0);
+    CPPUNIT_ASSERT(!number.IsDouble());
+
+    Value real(0.5);
+    CPPUNIT_ASSERT(real.IsDouble() && real.AsDouble() == 0.5);
+    CPPUNIT_ASSERT(Value(-1.5).AsDouble() == -1.5);
+    CPPUNIT_ASSERT(Value(-std::numeric_limits<double>::infinity()).IsDouble());
+
+    // Every NaN is the same double
+    Value nan(std::nan(""));
+    CPPUNIT_ASSERT(nan.IsDouble() && std::isnan(nan.AsDouble()));
+    CPPUNIT_ASSERT(Value(-std::nan("")).IsDouble());
+
+    CPPUNIT_ASSERT_THROW(number.AsBoolean(), std::bad_cast);
+    CPPUNIT_ASSERT_THROW(yes.AsNumber(), std::bad_cast);
+    CPPUNIT_ASSERT_THROW(real.GetObject(), std::bad_cast);
+
+    // Round trips through the basic types
+    CPPUNIT_ASSERT(Value(Integer(7)).IsInteger());
+    CPPUNIT_ASSERT(Value(Boolean(true)).AsBoolean());
+    CPPUNIT_ASSERT(Value(Double(2.5)).AsDouble() == 2.5);
+    CPPUNIT_ASSERT(*Integer(number.ToObject()) == -42);
+    CPPUNIT_ASSERT(*Boolean(yes.ToObject()));
+    CPPUNIT_ASSERT(*Double(real.ToObject()) == 0.5);
+
+    std::ostringstream os;
+    os << yes << " " << number << " " << real << " " << empty;
+    CPPUNIT_ASSERT(os.str() == "true -42 0.5 <NULL>");
+}
+
+void TestValue::testObjectMethod()
+{
+    String text("VALUE");
+    const Object &object = *static_cast<const ObjectPtr &>(text);
+    Value value(text);
+
+    CPPUNIT_ASSERT(value.IsObject() && !value.IsNumber());
+    CPPUNIT_ASSERT(&value.GetObject() == &object);
+    CPPUNIT_ASSERT(value.ToObject() == text);
+    CPPUNIT_ASSERT(*String(value.ToObject()) == "VALUE");
+
+    // Other arithmetic types are boxed
+    Value big(static_cast<int64_t>(1) << 40);
+    CPPUNIT_ASSERT(big.IsObject());
+    CPPUNIT_ASSERT(*Int64(big.ToObject()) == static_cast<int64_t>(1) << 40);
+    CPPUNIT_ASSERT(big == Value(Int64(static_cast<int64_t>(1) << 40)));
+
+    // Copies share the object, which outlives the pointer
+    Value copy(value);
+    {
+        Value other;
+        other = copy;
+        value = Value(3);
+        CPPUNIT_ASSERT(&other.GetObject() == &copy.GetObject());
+    }
+
+    text = String("OTHER");
+    CPPUNIT_ASSERT(*String(copy.ToObject()) == "VALUE");
+
+    Value moved(std::move(copy));
+    CPPUNIT_ASSERT(copy.IsNull() && moved.IsObject());
+    moved = moved;
+    CPPUNIT_ASSERT(*String(moved.ToObject()) == "VALUE");
+
+    std::ostringstream os;
+    os << moved;
+    CPPUNIT_ASSERT(os.str() == moved.GetObject().str());
+}
+
+void TestValue::testArithmeticMethod()
+{
+    CPPUNIT_ASSERT((Value(2) + Value(3)).AsInteger() == 5);
+    CPPUNIT_ASSERT((Value(2) - Value(3)).AsInteger() == -1);
+    CPPUNIT_ASSERT((Value(4) * Value(-3)).AsInteger() == -12);
+    CPPUNIT_ASSERT((Value(12) / Value(4)).AsInteger() == 3);
+    CPPUNIT_ASSERT((Value(7) / Value(2)).AsDouble() == 3.5);
+    CPPUNIT_ASSERT((-Value(5)).AsInteger() == -5);
+    CPPUNIT_ASSERT((-Value(0.5)).AsDouble() == -0.5);
+
+    // Mixed operands give doubles
+    CPPUNIT_ASSERT((Value(1) + Value(0.5)).AsDouble() == 1.5);
+    CPPUNIT_ASSERT((Value(1.5) * Value(2)).AsDouble() == 3.0);
+
+    // Overflowing integers give doubles
+    Value max(std::numeric_limits<int32_t>::max());
+    Value min(std::numeric_limits<int32_t>::min());
+    CPPUNIT_ASSERT((max + Value(1)).AsDouble() == 2147483648.0);
+    CPPUNIT_ASSERT((min - Value(1)).AsDouble() == -2147483649.0);
+    CPPUNIT_ASSERT((-min).AsDouble() == 2147483648.0);
+    CPPUNIT_ASSERT((min / Value(-1)).AsDouble() == 2147483648.0);
+    CPPUNIT_ASSERT((max * max).IsDouble());
+
+    CPPUNIT_ASSERT(std::isinf((Value(1) / Value(0)).AsDouble()));
+    CPPUNIT_ASSERT_THROW(Value(true) + Value(1), std::bad_cast);
+    CPPUNIT_ASSERT_THROW(Value(String("1")) * Value(1), std::bad_cast);
+}
+
+void TestValue::testCompareMethod()
+{
+    CPPUNIT_ASSERT(Value(1) < Value(2) && Value(2) > Value(1));
+    CPPUNIT_ASSERT(Value(-0.5) < Value(0.25));
+    CPPUNIT_ASSERT(Value(false) < Value(true));
+    CPPUNIT_ASSERT(Value(3) == Value(3) && Value(3) <= Value(3));
+    CPPUNIT_ASSERT(Value() == Value() && Value() < Value(false));
+    CPPUNIT_ASSERT(Value(String("A")) < Value(String("B")));
+    CPPUNIT_ASSERT(Value(String("A")) == Value(String("A")));
+    CPPUNIT_ASSERT(Value(std::nan("")).compare(Value(1.0)) ==
+                   Ordering::Unordered);
+
+    // Values order and hash as the objects they box
+    std::vector<ObjectPtr> objects = {Integer(3), Double(1.5), Boolean(true),
+                                      String("A"), Int64(8), Double(-2.0),
+                                      Integer(-3), Boolean(false)};
+
+    for(const ObjectPtr &a : objects)
+    {
+        Value value(a);
+        CPPUNIT_ASSERT(value.hash() == std::hash<ObjectPtr>()(a));
+
+        for(const ObjectPtr &b : objects)
+        {
+            CPPUNIT_ASSERT(value.compare(Value(b)) == (*a).compare(*b));
+        }
+    }
+
+    CPPUNIT_ASSERT(Value(3) != Value(3.0));
+
+    std::unordered_set<Value> set = {Value(1), Value(1.0), Value(true),
+                                     Value(String("A")), Value(1)};
+    CPPUNIT_ASSERT(set.size() == 4);
+    CPPUNIT_ASSERT(set.count(Value(String("A"))));
+}
\ No newline at end of file
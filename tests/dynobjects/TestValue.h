@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   TestValue.h
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 23:00
+ */
+
+#ifndef TEST_DYNOBJECTS_VALUE_H
+#define TEST_DYNOBJECTS_VALUE_H
+
+/// Internal libs includes
+#include "dynobjects/Value.h"
+
+/// External libs includes
+
+// CppUnit
+#include <cppunit/extensions/HelperMacros.h>
+
+class TestValue : public CPPUNIT_NS::TestFixture
+{
+private:
+
+    /// Test registration
+
+    CPPUNIT_TEST_SUITE(TestValue);
+
+    CPPUNIT_TEST(testScalarMethod);
+    CPPUNIT_TEST(testObjectMethod);
+    CPPUNIT_TEST(testArithmeticMethod);
+    CPPUNIT_TEST(testCompareMethod);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    TestValue();
+    virtual ~TestValue();
+    void setUp();
+    void tearDown();
+
+private:
+    void testScalarMethod();
+    void testObjectMethod();
+    void testArithmeticMethod();
+    void testCompareMethod();
+};
+
+#endif /* TEST_DYNOBJECTS_VALUE_H */
+
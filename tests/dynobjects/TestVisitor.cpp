@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2017 Mario Salazar de Torres
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   TestVisitor.cpp
+ * Author: Mario Salazar de Torres
+ *
+ * Created on 10/17/2026, 23:45
+ */
+
+/// Internal libs includes
+
+#include "TestVisitor.h"
+#include "dynobjects/Atom.h"
+#include "dynobjects/Record.h"
+
+/// External libs includes
+
+// C++11 standard
+#include <string>
+#include <typeinfo>
+
+using namespace DynObjects;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestVisitor);
+
+TestVisitor::TestVisitor()
+{
+}
+
+TestVisitor::~TestVisitor()
+{
+}
+
+void TestVisitor::setUp()
+{
+}
+
+void TestVisitor::tearDown()
+{
+}
+
+void TestVisitor::testVisitMethod()
+{
+    auto describe = Overload(
+        [](int value) { return "int " + std::to_string(value); },
+        [](bool value) { return std::string(value ? "true" : "false"); },
+        [](double value) { return "double " + std::to_string(value); },
+        [](const std::string &value) { return "string " + value; },
+        [](const Text::object_type &value)
+        {
+            return "text " + value.ToString();
+        },
+        [](const std::vector<ObjectPtr> &value)
+        {
+            return "vector " + std::to_string(value.size());
+        },
+        [](const Object &o) { return "object " + o.GetObjectTypeName(); });
+
+    CPPUNIT_ASSERT(Visit(Integer(3), describe) == "int 3");
+    CPPUNIT_ASSERT(Visit(Int32(-3), describe) == "int -3");
+    CPPUNIT_ASSERT(Visit(Boolean(true), describe) == "true");
+    CPPUNIT_ASSERT(Visit(Double(0.5), describe) == "double 0.500000");
+    CPPUNIT_ASSERT(Visit(String("KEY"), describe) == "string KEY");
+    CPPUNIT_ASSERT(Visit(Text("KEY"), describe) == "text KEY");
+    CPPUNIT_ASSERT(Visit(Vector<ObjectPtr>(2), describe) == "vector 2");
+
+    // Items are only given to the overloads taking exactly their type
+    CPPUNIT_ASSERT(Visit(Char('a'), describe) == "object char");
+    CPPUNIT_ASSERT(Visit(Float(0.5f), describe) == "object float");
+    CPPUNIT_ASSERT(Visit(Dictionary(), describe).find("object ") == 0);
+
+    // Types out of the list get the object
+    CPPUNIT_ASSERT(Visit(RecordInstance(), describe).find("object ") == 0);
+
+    // Without an overload for any object, the result is void
+    int count = 0;
+    auto counter = Overload([&count](int value) { count += value; });
+    Visit(Integer(2), counter);
+    Visit(Integer(3), counter);
+    CPPUNIT_ASSERT(count == 5);
+    CPPUNIT_ASSERT_THROW(Visit(Boolean(true), counter), std::bad_cast);
+    CPPUNIT_ASSERT_THROW(Visit(ObjectPtr(), describe), std::bad_cast);
+}
+
+void TestVisitor::testUserTypesMethod()
+{
+    typedef StandardTypes::With<Record, Atom::object_type> Types;
+
+    auto describe = Overload(
+        [](int value) { return "int " + std::to_string(value); },
+        [](const Record &value)
+        {
+            return "record " + std::to_string(value.GetSize());
+        },
+        [](const Symbol &value) { return "symbol " + value.GetName(); },
+        [](const Object &) { return std::string("object"); });
+
+    RecordInstance pRecord;
+    (*pRecord).Set("KEY", Integer(1));
+
+    CPPUNIT_ASSERT(Visit<Types>(pRecord, describe) == "record 1");
+    CPPUNIT_ASSERT(Visit<Types>(Atom("KEY"), describe) == "symbol KEY");
+    CPPUNIT_ASSERT(Visit<Types>(Integer(1), describe) == "int 1");
+    CPPUNIT_ASSERT(Visit(Atom("KEY"), describe) == "object");
+}
+
+void TestVisitor::testDoubleDispatchMethod()
+{
+    auto add = Overload(
+        [](int a, int b) { return ObjectPtr(Integer(a + b)); },
+        [](double a, double b) { return ObjectPtr(Double(a + b)); },
+        [](int a, double b) { return ObjectPtr(Double(a + b)); },
+        [](double a, int b) { return ObjectPtr(Double(a + b)); },
+        [](const std::string &a, const std::string &b)
+        {
+            return ObjectPtr(String(a + b));
+        },
+        [](const Object &, const Object &) { return ObjectPtr(); });
+
+    CPPUNIT_ASSERT(Visit(Integer(1), Integer(2), add) == Integer(3));
+    CPPUNIT_ASSERT(Visit(Integer(1), Double(0.5), add) == Double(1.5));
+    CPPUNIT_ASSERT(Visit(Double(0.5), Integer(1), add) == Double(1.5));
+    CPPUNIT_ASSERT(Visit(String("A"), String("B"), add) == String("AB"));
+    CPPUNIT_ASSERT(!Visit(String("A"), Integer(1), add));
+    CPPUNIT_ASSERT(!Visit(Boolean(true), Integer(1), add));
+
+    auto strict = Overload([](int a, int b) { return a - b; });
+    CPPUNIT_ASSERT_THROW(Visit(Integer(1), Double(0.5), strict),
+                         std::bad_cast);
+    CPPUNIT_ASSERT_THROW(Visit(Integer(1), ObjectPtr(), add), std::bad_cast);
+}
\ No newline at end of file